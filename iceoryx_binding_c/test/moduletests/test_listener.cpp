@@ -91,14 +91,14 @@ class iox_listener_test : public Test
         m_mempoolconf.addMemPool({CHUNK_SIZE, NUM_CHUNKS_IN_POOL});
         m_memoryManager.configureMemoryManager(m_mempoolconf, m_memoryAllocator, m_memoryAllocator);
 
-        m_subscriberPortData.resize(MAX_NUMBER_OF_EVENTS_PER_LISTENER + 1U,
-                                    TEST_SERVICE_DESCRIPTION,
-                                    "myApp",
-                                    iox::cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer,
-                                    subscriberOptions);
         m_subscriber.resize(MAX_NUMBER_OF_EVENTS_PER_LISTENER + 1U);
         for (uint64_t i = 0U; i < MAX_NUMBER_OF_EVENTS_PER_LISTENER + 1U; ++i)
         {
+            m_subscriberPortData.emplace_back(TEST_SERVICE_DESCRIPTION,
+                                              "myApp",
+                                              iox::cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer,
+                                              subscriberOptions,
+                                              iox::popo::ChunkQueueMemory{&m_queueMemory[i], 0U});
             m_userTrigger.emplace_back(iox_user_trigger_init(&m_userTriggerStorage[i]));
             m_subscriber[i].m_portData = &m_subscriberPortData[i];
             m_chunkPusher.emplace_back(&m_subscriberPortData[i].m_chunkReceiverData);
@@ -162,6 +162,7 @@ class iox_listener_test : public Test
 
     iox::popo::SubscriberOptions subscriberOptions{MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY, 0U};
 
+    SubscriberPortData::ChunkQueue_t::MaxCapacityMemory_t m_queueMemory[MAX_NUMBER_OF_EVENTS_PER_LISTENER + 1];
     cxx::vector<iox::popo::SubscriberPortData, MAX_NUMBER_OF_EVENTS_PER_LISTENER + 1> m_subscriberPortData;
     cxx::vector<cpp2c_Subscriber, MAX_NUMBER_OF_EVENTS_PER_LISTENER + 1> m_subscriber;
     cxx::vector<ChunkQueuePusher<SubscriberPortData::ChunkQueueData_t>, MAX_NUMBER_OF_EVENTS_PER_LISTENER + 1>
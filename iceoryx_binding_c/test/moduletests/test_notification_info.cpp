@@ -105,10 +105,12 @@ class iox_notification_info_test : public Test
     MePooConfig m_mempoolconf;
     MemoryManager m_memoryManager;
     SubscriberOptions m_subscriberOptions{MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY, 0U};
+    iox::popo::SubscriberPortData::ChunkQueue_t::MaxCapacityMemory_t m_queueMemory;
     iox::popo::SubscriberPortData m_portPtr{TEST_SERVICE_DESCRIPTION,
                                             "myApp",
                                             iox::cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer,
-                                            m_subscriberOptions};
+                                            m_subscriberOptions,
+                                            iox::popo::ChunkQueueMemory{&m_queueMemory, 0U}};
     ChunkQueuePusher<SubscriberPortData::ChunkQueueData_t> m_chunkPusher{&m_portPtr.m_chunkReceiverData};
     cpp2c_Subscriber m_subscriber;
     iox_sub_t m_subscriberHandle = &m_subscriber;
@@ -102,9 +102,11 @@ class iox_pub_test : public Test
     static constexpr uint32_t NUM_CHUNKS_IN_POOL = 20;
     static constexpr uint32_t CHUNK_SIZE = 256;
 
-    using ChunkQueueData_t = popo::ChunkQueueData<DefaultChunkQueueConfig, popo::ThreadSafePolicy>;
+    using ChunkQueueData_t = popo::SubscriberPortData::ChunkQueueData_t;
+    popo::SubscriberPortData::ChunkQueue_t::MaxCapacityMemory_t m_queueMemory;
     ChunkQueueData_t m_chunkQueueData{iox::popo::QueueFullPolicy::DISCARD_OLDEST_DATA,
-                                      iox::cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer};
+                                      iox::cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer,
+                                      popo::ChunkQueueMemory{&m_queueMemory, 0U}};
 
     GenericRAII m_uniqueRouDiId{[] { popo::internal::setUniqueRouDiId(0); },
                                 [] { popo::internal::unsetUniqueRouDiId(); }};
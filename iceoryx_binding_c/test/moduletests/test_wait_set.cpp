@@ -57,7 +57,8 @@ class iox_ws_test : public Test
             m_portDataVector.emplace_back(TEST_SERVICE_DESCRIPTION,
                                           "someAppName",
                                           iox::cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer,
-                                          m_subscriberOptions);
+                                          m_subscriberOptions,
+                                          iox::popo::ChunkQueueMemory{&m_queueMemory[i], 0U});
             m_subscriberVector.emplace_back();
             m_subscriberVector[i].m_portData = &m_portDataVector[i];
         }
@@ -80,6 +81,8 @@ class iox_ws_test : public Test
 
     const iox::capro::ServiceDescription TEST_SERVICE_DESCRIPTION{"a", "b", "c"};
     iox::popo::SubscriberOptions m_subscriberOptions{MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY, 0U};
+    iox::popo::SubscriberPortData::ChunkQueue_t::MaxCapacityMemory_t
+        m_queueMemory[MAX_NUMBER_OF_ATTACHMENTS_PER_WAITSET + 1U];
     cxx::vector<iox::popo::SubscriberPortData, MAX_NUMBER_OF_ATTACHMENTS_PER_WAITSET + 1U> m_portDataVector;
     cxx::vector<cpp2c_Subscriber, MAX_NUMBER_OF_ATTACHMENTS_PER_WAITSET + 1U> m_subscriberVector;
 
@@ -155,6 +155,10 @@ namespace iox
     error(POSIX_TIMER__TIMERPOOL_OVERFLOW) \
     error(POSIX_TIMER__INCONSISTENT_STATE) \
     error(POSIX_TIMER__CALLBACK_RUNTIME_EXCEEDS_RETRIGGER_TIME) \
+    error(TIMER_WHEEL__CALLBACK_RUNTIME_EXCEEDS_PERIOD) \
+    error(TIMER_WHEEL__UNABLE_TO_CREATE_WAKEUP_TIMER) \
+    error(TIMER_WHEEL__DESTROYED_WITH_TIMERS_IN_USE) \
+    error(PERIODIC_TASK__TIMER_LIMIT_REACHED) \
     error(BINDING_C__UNDEFINED_STATE_IN_IOX_QUEUE_FULL_POLICY) \
     error(BINDING_C__UNDEFINED_STATE_IN_IOX_SUBSCRIBER_TOO_SLOW_POLICY) \
     error(BINDING_C__PUBLISHER_OPTIONS_NOT_INITIALIZED) \
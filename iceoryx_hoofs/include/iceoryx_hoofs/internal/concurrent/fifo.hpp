@@ -18,6 +18,7 @@
 #define IOX_HOOFS_CONCURRENT_FIFO_HPP
 
 #include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/internal/concurrent/padded_atomic.hpp"
 
 #include <atomic>
 
@@ -54,7 +55,9 @@ class FiFo
 
   private:
     ValueType m_data[Capacity];
-    std::atomic<uint64_t> m_write_pos{0};
+    /// @brief the write position is written by the producer and the read position by the consumer, they are on
+    ///        separate cache lines when the data covers more than one cache line
+    PaddedAtomic<uint64_t, isPaddingWorthwhile(sizeof(m_data))> m_write_pos{0};
     std::atomic<uint64_t> m_read_pos{0};
 };
 
@@ -21,6 +21,7 @@
 #include "iceoryx_hoofs/cxx/optional.hpp"
 #include "iceoryx_hoofs/internal/concurrent/lockfree_queue/buffer.hpp"
 #include "iceoryx_hoofs/internal/concurrent/lockfree_queue/cyclic_index.hpp"
+#include "iceoryx_hoofs/internal/concurrent/padded_atomic.hpp"
 
 #include <atomic>
 #include <type_traits>
@@ -118,7 +119,9 @@ class IndexQueue
     ///    See, http://www.open-std.org/jtc1/sc22/wg21/docs/papers/2018/p0883r0.pdf
     Cell m_cells[Capacity];
 
-    std::atomic<Index> m_readPosition;
+    /// @brief the read position is written by the consumers and the write position by the producers, they are on
+    ///        separate cache lines when the cells cover more than one cache line
+    PaddedAtomic<Index, isPaddingWorthwhile(sizeof(m_cells))> m_readPosition;
     std::atomic<Index> m_writePosition;
 
     /// @brief load the value from m_cells at a position with a given memory order
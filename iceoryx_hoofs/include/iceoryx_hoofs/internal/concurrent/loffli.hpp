@@ -18,6 +18,7 @@
 #define IOX_HOOFS_CONCURRENT_LOFFLI_HPP
 
 #include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_hoofs/internal/concurrent/padded_atomic.hpp"
 #include "iceoryx_hoofs/internal/relocatable_pointer/relative_pointer.hpp"
 
 #include <atomic>
@@ -65,9 +66,11 @@ class LoFFLi
     ///    };
     /// @endcode
 
+    /// @brief the head is written by every push and pop, the members which are only written by init are therefore
+    ///        placed on another cache line
+    PaddedAtomic<Node> m_head{{0U, 1U}};
     uint32_t m_size{0U};
     Index_t m_invalidIndex{0U};
-    std::atomic<Node> m_head{{0U, 1U}};
     iox::rp::RelativePointer<Index_t> m_nextFreeIndex;
 
   public:
@@ -0,0 +1,70 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_HOOFS_CONCURRENT_PADDED_ATOMIC_HPP
+#define IOX_HOOFS_CONCURRENT_PADDED_ATOMIC_HPP
+
+#include "iceoryx_hoofs/platform/platform_settings.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace concurrent
+{
+/// @brief returns true if data of the given size covers at least one cache line. Only then it is worthwhile to
+///        separate the positions of the producer and the consumer of a queue, the data of a smaller queue is on the
+///        same cache lines as its positions anyway.
+constexpr bool isPaddingWorthwhile(const uint64_t dataSize) noexcept
+{
+    return dataSize >= platform::IOX_CACHE_LINE_SIZE;
+}
+
+/// @brief An std::atomic which is followed by padding up to the size of a cache line if IsPadded is true. The member
+///        which follows a padded atomic is therefore never on the cache line of the atomic. In contrast to alignas
+///        this does not increase the alignment of the enclosing type, which would not be supported by new in C++14.
+/// @code
+///   T m_data[Capacity];
+///   PaddedAtomic<uint64_t, isPaddingWorthwhile(sizeof(m_data))> m_writePosition{0U}; // written by the producer
+///   std::atomic<uint64_t> m_readPosition{0U};                                        // written by the consumer
+/// @endcode
+template <typename T, bool IsPadded = true>
+class PaddedAtomic : public std::atomic<T>
+{
+  public:
+    PaddedAtomic() noexcept = default;
+    using std::atomic<T>::atomic;
+    using std::atomic<T>::operator=;
+
+  private:
+    static_assert(sizeof(std::atomic<T>) < platform::IOX_CACHE_LINE_SIZE, "the atomic must fit into a cache line");
+    uint8_t m_padding[platform::IOX_CACHE_LINE_SIZE - sizeof(std::atomic<T>)];
+};
+
+/// @brief the unpadded PaddedAtomic has the size of std::atomic
+template <typename T>
+class PaddedAtomic<T, false> : public std::atomic<T>
+{
+  public:
+    PaddedAtomic() noexcept = default;
+    using std::atomic<T>::atomic;
+    using std::atomic<T>::operator=;
+};
+
+} // namespace concurrent
+} // namespace iox
+
+#endif // IOX_HOOFS_CONCURRENT_PADDED_ATOMIC_HPP
@@ -17,15 +17,14 @@
 #ifndef IOX_HOOFS_CONCURRENT_PERIODIC_TASK_HPP
 #define IOX_HOOFS_CONCURRENT_PERIODIC_TASK_HPP
 
+#include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_hoofs/cxx/optional.hpp"
 #include "iceoryx_hoofs/cxx/string.hpp"
+#include "iceoryx_hoofs/error_handling/error_handling.hpp"
+#include "iceoryx_hoofs/internal/concurrent/timer_wheel.hpp"
 #include "iceoryx_hoofs/internal/units/duration.hpp"
-#include "iceoryx_hoofs/posix_wrapper/semaphore.hpp"
 #include "iceoryx_hoofs/posix_wrapper/thread.hpp"
 
-#include <thread>
-
-#include <iostream>
-
 namespace iox
 {
 namespace concurrent
@@ -58,7 +57,10 @@ static constexpr PeriodicTaskManualStart_t PeriodicTaskManualStart;
 ///         return 0;
 /// }
 /// @endcode
-/// @note Currently execution time of the callable is added to the interval.
+/// @note The callable is executed in the thread of a TimerWheel. By default this is the process wide TimerWheel which
+///       is shared by all periodic tasks and posix::Timer, therefore the callable must be short and must not block;
+///       a callable which might block needs its own TimerWheel. The interval is measured from the start of the task;
+///       if an execution takes longer than the interval, the missed executions are skipped.
 /// @tparam T is a callable type without function parameters
 template <typename T>
 class PeriodicTask
@@ -69,18 +71,30 @@ class PeriodicTask
     /// @tparam Args are variadic template parameter for which are forwarded to the underlying callable object
     /// @param[in] PeriodicTaskManualStart_t indicates that this ctor doesn't start the task; just pass
     /// `PeriodicTaskManualStart` as argument
-    /// @param[in] taskName will be set as thread name
+    /// @param[in] taskName identifies the task; it is not used since the callable is executed in the thread of the
+    /// TimerWheel and only kept for source compatibility
     /// @param[in] args are forwarded to the underlying callable object
     template <typename... Args>
     PeriodicTask(const PeriodicTaskManualStart_t, const posix::ThreadName_t taskName, Args&&... args) noexcept;
 
-    /// @brief Creates a periodic task by spawning a thread. The specified callable is executed immediately on creation
-    /// and then periodically after the interval duration.
+    /// @brief Creates a periodic task which is executed by the provided TimerWheel. The specified callable is stored
+    /// but not executed. To run the task, `void start(const units::Duration interval)` must be called.
+    /// @param[in] timerWheel which executes the task, it must outlive the PeriodicTask
+    /// @note see the overload without TimerWheel for the other parameters
+    template <typename... Args>
+    PeriodicTask(const PeriodicTaskManualStart_t,
+                 TimerWheel& timerWheel,
+                 const posix::ThreadName_t taskName,
+                 Args&&... args) noexcept;
+
+    /// @brief Creates a periodic task. The specified callable is executed with the next tick of the TimerWheel and then
+    /// periodically after the interval duration.
     /// @tparam Args are variadic template parameter for which are forwarded to the underlying callable object
     /// @param[in] PeriodicTaskAutoStart_t indicates that this ctor starts the task; just pass
     /// `PeriodicTaskAutoStart` as argument
-    /// @param[in] interval is the time the thread waits between two invocations of the callable
-    /// @param[in] taskName will be set as thread name
+    /// @param[in] interval is the time between two invocations of the callable
+    /// @param[in] taskName identifies the task; it is not used since the callable is executed in the thread of the
+    /// TimerWheel and only kept for source compatibility
     /// @param[in] args are forwarded to the underlying callable object
     template <typename... Args>
     PeriodicTask(const PeriodicTaskAutoStart_t,
@@ -88,7 +102,17 @@ class PeriodicTask
                  const posix::ThreadName_t taskName,
                  Args&&... args) noexcept;
 
-    /// @brief Stops and joins the thread spawned by the constructor.
+    /// @brief Creates a periodic task which is executed by the provided TimerWheel and starts it.
+    /// @param[in] timerWheel which executes the task, it must outlive the PeriodicTask
+    /// @note see the overload without TimerWheel for the other parameters
+    template <typename... Args>
+    PeriodicTask(const PeriodicTaskAutoStart_t,
+                 TimerWheel& timerWheel,
+                 const units::Duration interval,
+                 const posix::ThreadName_t taskName,
+                 Args&&... args) noexcept;
+
+    /// @brief Stops the task.
     /// @note This is blocking and the blocking time depends on the callable.
     ~PeriodicTask() noexcept;
 
@@ -98,32 +122,30 @@ class PeriodicTask
     PeriodicTask& operator=(const PeriodicTask&) = delete;
     PeriodicTask& operator=(PeriodicTask&&) = delete;
 
-    /// @brief Spawns a thread and immediately executes the callable specified with the constructor.
-    /// The execution is repeated after the specified interval is passed.
-    /// @param[in] interval is the time the thread waits between two invocations of the callable
-    /// @attention If the PeriodicTask instance has already a running thread, this will be stopped and started again
-    /// with the new interval. This might take some time if a slow task is executing during this call.
+    /// @brief Schedules the callable specified with the constructor for the next tick of the TimerWheel, i.e. it is
+    /// executed almost immediately but asynchronously in the wheel thread. The execution is repeated every time the
+    /// specified interval is passed.
+    /// @param[in] interval is the time between two invocations of the callable
+    /// @attention If the PeriodicTask instance is already active, it will be stopped and started again with the new
+    /// interval. This might take some time if a slow task is executing during this call.
     void start(const units::Duration interval) noexcept;
 
-    /// @brief This stops the thread if it's running, otherwise does nothing. When this method returns, the thread is
-    /// stopped.
+    /// @brief This stops the task if it's active, otherwise does nothing. When this method returns, the callable is not
+    /// executing anymore.
     /// @attention This might take some time if a slow task is executing during this call.
     void stop() noexcept;
 
-    /// @brief This method check if a thread is spawned and running, potentially executing a task.
-    /// @return true if the thread is running, false otherwise.
+    /// @brief This method checks if the task is started, potentially executing the callable.
+    /// @return true if the task is active, false otherwise.
     bool isActive() const noexcept;
 
   private:
-    void run() noexcept;
+    static constexpr units::Duration FIRST_EXECUTION_DELAY{units::Duration::fromNanoseconds(1U)};
 
-  private:
     T m_callable;
-    posix::ThreadName_t m_taskName;
+    TimerWheel& m_timerWheel;
     units::Duration m_interval{units::Duration::fromMilliseconds(0U)};
-    /// @todo use a refactored posix::Timer object once available
-    posix::Semaphore m_stop{posix::Semaphore::create(posix::CreateUnnamedSingleProcessSemaphore, 0U).value()};
-    std::thread m_taskExecutor;
+    cxx::optional<TimerWheel::TimerId> m_timerId;
 };
 
 } // namespace concurrent
@@ -21,23 +21,47 @@ namespace iox
 {
 namespace concurrent
 {
+template <typename T>
+constexpr units::Duration PeriodicTask<T>::FIRST_EXECUTION_DELAY;
+
 template <typename T>
 template <typename... Args>
 inline PeriodicTask<T>::PeriodicTask(const PeriodicTaskManualStart_t,
                                      const posix::ThreadName_t taskName,
                                      Args&&... args) noexcept
+    : PeriodicTask(PeriodicTaskManualStart, TimerWheel::instance(), taskName, std::forward<Args>(args)...)
+{
+}
+
+template <typename T>
+template <typename... Args>
+inline PeriodicTask<T>::PeriodicTask(const PeriodicTaskManualStart_t,
+                                     TimerWheel& timerWheel,
+                                     const posix::ThreadName_t,
+                                     Args&&... args) noexcept
     : m_callable(std::forward<Args>(args)...)
-    , m_taskName(taskName)
+    , m_timerWheel(timerWheel)
+{
+}
+
+template <typename T>
+template <typename... Args>
+inline PeriodicTask<T>::PeriodicTask(const PeriodicTaskAutoStart_t,
+                                     const units::Duration interval,
+                                     const posix::ThreadName_t taskName,
+                                     Args&&... args) noexcept
+    : PeriodicTask(PeriodicTaskAutoStart, TimerWheel::instance(), interval, taskName, std::forward<Args>(args)...)
 {
 }
 
 template <typename T>
 template <typename... Args>
 inline PeriodicTask<T>::PeriodicTask(const PeriodicTaskAutoStart_t,
+                                     TimerWheel& timerWheel,
                                      const units::Duration interval,
                                      const posix::ThreadName_t taskName,
                                      Args&&... args) noexcept
-    : PeriodicTask(PeriodicTaskManualStart, taskName, std::forward<Args>(args)...)
+    : PeriodicTask(PeriodicTaskManualStart, timerWheel, taskName, std::forward<Args>(args)...)
 {
     start(interval);
 }
@@ -53,40 +77,34 @@ inline void PeriodicTask<T>::start(const units::Duration interval) noexcept
 {
     stop();
     m_interval = interval;
-    m_taskExecutor = std::thread(&PeriodicTask::run, this);
-    posix::setThreadName(m_taskExecutor.native_handle(), m_taskName);
+
+    m_timerWheel.add([this] { IOX_DISCARD_RESULT(m_callable()); })
+        .and_then([&](auto& timerId) {
+            m_timerId.emplace(timerId);
+            // the first execution happens with the next tick of the wheel, i.e. the callable is never executed in
+            // the thread which starts the task
+            cxx::Expects(
+                !m_timerWheel
+                     .arm(timerId, FIRST_EXECUTION_DELAY, m_interval, TimerWheel::CatchUpPolicy::SKIP_TO_NEXT_BEAT)
+                     .has_error());
+        })
+        .or_else([](auto&) { errorHandler(Error::kPERIODIC_TASK__TIMER_LIMIT_REACHED); });
 }
 
 template <typename T>
 inline void PeriodicTask<T>::stop() noexcept
 {
-    if (m_taskExecutor.joinable())
+    if (m_timerId.has_value())
     {
-        cxx::Expects(!m_stop.post().has_error());
-        m_taskExecutor.join();
+        cxx::Expects(!m_timerWheel.remove(m_timerId.value()).has_error());
+        m_timerId.reset();
     }
 }
 
 template <typename T>
 inline bool PeriodicTask<T>::isActive() const noexcept
 {
-    return m_taskExecutor.joinable();
-}
-
-template <typename T>
-inline void PeriodicTask<T>::run() noexcept
-{
-    posix::SemaphoreWaitState waitState = posix::SemaphoreWaitState::NO_TIMEOUT;
-    do
-    {
-        IOX_DISCARD_RESULT(m_callable());
-
-        /// @todo use a refactored posix::Timer::wait method returning TIMER_TICK and TIMER_STOPPED once available
-        auto waitResult = m_stop.timedWait(m_interval);
-        cxx::Expects(!waitResult.has_error());
-
-        waitState = waitResult.value();
-    } while (waitState == posix::SemaphoreWaitState::TIMEOUT);
+    return m_timerId.has_value();
 }
 
 } // namespace concurrent
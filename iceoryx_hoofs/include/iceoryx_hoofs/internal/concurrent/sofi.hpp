@@ -17,6 +17,7 @@
 #ifndef IOX_HOOFS_CONCURRENT_SOFI_HPP
 #define IOX_HOOFS_CONCURRENT_SOFI_HPP
 
+#include "iceoryx_hoofs/internal/concurrent/padded_atomic.hpp"
 #include "iceoryx_hoofs/platform/platform_correction.hpp"
 
 #include <atomic>
@@ -155,8 +156,9 @@ class SoFi
     uint64_t m_size = INTERNAL_SOFI_SIZE;
 
     /// @brief the write/read pointers are "atomic pointers" so that they are not
-    /// reordered (read or written too late)
-    std::atomic<uint64_t> m_readPosition{0u};
+    /// reordered (read or written too late); the read position is written by the consumer and the write position by
+    /// the producer, they are on separate cache lines when the data covers more than one cache line
+    PaddedAtomic<uint64_t, isPaddingWorthwhile(sizeof(m_data))> m_readPosition{0u};
     std::atomic<uint64_t> m_writePosition{0u};
 };
 
@@ -0,0 +1,222 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_HOOFS_CONCURRENT_TIMER_WHEEL_HPP
+#define IOX_HOOFS_CONCURRENT_TIMER_WHEEL_HPP
+
+#include "iceoryx_hoofs/cxx/expected.hpp"
+#include "iceoryx_hoofs/cxx/function.hpp"
+#include "iceoryx_hoofs/internal/units/duration.hpp"
+#include "iceoryx_hoofs/posix_wrapper/thread.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <thread>
+
+namespace iox
+{
+namespace concurrent
+{
+enum class TimerWheelError
+{
+    INVALID_STATE,
+    TIMER_LIMIT_REACHED,
+    INVALID_TIMER_ID,
+    TIMEOUT_IS_ZERO
+};
+
+/// @brief A hierarchical timer wheel which drives an arbitrary number of software timers (up to
+///        MAX_NUMBER_OF_TIMERS) from a single thread. Arming and disarming a timer is O(1), the wheel thread only
+///        wakes up when a timer expires or, while timers are armed, at the latest every LEVEL_0_SLOTS ticks to
+///        cascade the outer levels.
+///        The callbacks of all timers are executed sequentially in the wheel thread, therefore they must be short
+///        and must not block. Components with callbacks which might block need to use a dedicated wheel.
+///        On Linux the wheel thread sleeps on a timerfd which is armed with the absolute CLOCK_MONOTONIC time of the
+///        next expiration; on the other platforms a condition variable on the steady clock is used.
+/// @code
+///     auto& wheel = iox::concurrent::TimerWheel::instance();
+///     auto timerId = wheel.add([] { std::cout << "tick" << std::endl; }).value();
+///     wheel.arm(timerId, 100_ms, 100_ms, TimerWheel::CatchUpPolicy::SKIP_TO_NEXT_BEAT);
+///     // [.. wait ..]
+///     wheel.remove(timerId);
+/// @endcode
+/// @concurrent thread safe
+class TimerWheel
+{
+  public:
+    using Callback_t = cxx::function<void()>;
+
+    /// @brief defines the behavior of a periodic timer when the runtime of its callback exceeds the period
+    ///        SKIP_TO_NEXT_BEAT the missed expirations are dropped and the timer continues with the next beat
+    ///        IMMEDIATE the callback is called once right after the previous invocation has finished
+    ///        TERMINATE calls the errorHandler with TIMER_WHEEL__CALLBACK_RUNTIME_EXCEEDS_PERIOD
+    enum class CatchUpPolicy
+    {
+        SKIP_TO_NEXT_BEAT,
+        IMMEDIATE,
+        TERMINATE
+    };
+
+    /// @brief identifies a timer of the wheel; the generation detects the use of an id after its timer was removed
+    struct TimerId
+    {
+        uint32_t index{0U};
+        uint32_t generation{0U};
+    };
+
+    static constexpr uint32_t MAX_NUMBER_OF_TIMERS{256U};
+    static constexpr units::Duration DEFAULT_RESOLUTION{units::Duration::fromMilliseconds(1U)};
+
+    /// @brief returns the process wide timer wheel; the wheel thread is started with the first call
+    /// @note the process wide wheel is never destroyed, therefore timers with static storage duration can be removed
+    ///       in their destructor
+    static TimerWheel& instance() noexcept;
+
+    /// @brief creates a timer wheel and starts its thread
+    /// @param[in] resolution is the duration of one tick, all expirations are rounded up to a full tick
+    /// @param[in] threadName is the name of the wheel thread
+    explicit TimerWheel(const units::Duration resolution = DEFAULT_RESOLUTION,
+                        const posix::ThreadName_t& threadName = "TimerWheel") noexcept;
+
+    /// @brief stops and joins the wheel thread
+    /// @attention all timers need to be removed before the wheel is destroyed, otherwise the errorHandler is called
+    ///            with TIMER_WHEEL__DESTROYED_WITH_TIMERS_IN_USE
+    ~TimerWheel() noexcept;
+
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel(TimerWheel&&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+    TimerWheel& operator=(TimerWheel&&) = delete;
+
+    /// @brief acquires a disarmed timer
+    /// @param[in] callback which is called in the wheel thread whenever the timer expires
+    /// @return the id of the timer or TimerWheelError::TIMER_LIMIT_REACHED when all timers are in use
+    cxx::expected<TimerId, TimerWheelError> add(const Callback_t& callback) noexcept;
+
+    /// @brief arms a timer; if the timer is already armed it is re-armed with the new values
+    /// @param[in] timerId of the timer to arm
+    /// @param[in] timeToWait until the first expiration, it is rounded up to the next tick and must not be zero
+    /// @param[in] period between two expirations, zero results in a one shot timer
+    /// @param[in] catchUpPolicy defines the behavior when the callback runtime exceeds the period
+    cxx::expected<TimerWheelError> arm(const TimerId timerId,
+                                       const units::Duration timeToWait,
+                                       const units::Duration period,
+                                       const CatchUpPolicy catchUpPolicy) noexcept;
+
+    /// @brief disarms a timer without waiting for a currently running callback
+    cxx::expected<TimerWheelError> disarm(const TimerId timerId) noexcept;
+
+    /// @brief disarms and releases a timer; if its callback is currently running the call blocks until it has
+    ///        finished, unless it is called from within the callback
+    cxx::expected<TimerWheelError> remove(const TimerId timerId) noexcept;
+
+    /// @brief returns the time until the next expiration of the timer or zero if it is not armed
+    cxx::expected<units::Duration, TimerWheelError> timeUntilExpiration(const TimerId timerId) const noexcept;
+
+    /// @brief returns the number of expirations which were missed by a periodic timer at its last invocation
+    cxx::expected<uint64_t, TimerWheelError> getOverruns(const TimerId timerId) const noexcept;
+
+    /// @brief returns true if the timer is armed
+    cxx::expected<bool, TimerWheelError> isArmed(const TimerId timerId) const noexcept;
+
+  private:
+    static constexpr uint32_t INVALID_INDEX{MAX_NUMBER_OF_TIMERS};
+    static constexpr uint64_t LEVEL_0_BITS{8U};
+    static constexpr uint64_t LEVEL_N_BITS{6U};
+    static constexpr uint64_t NUMBER_OF_LEVELS{4U};
+    static constexpr uint64_t LEVEL_0_SLOTS{1U << LEVEL_0_BITS};
+    static constexpr uint64_t LEVEL_N_SLOTS{1U << LEVEL_N_BITS};
+    static constexpr uint32_t NUMBER_OF_WHEEL_SLOTS{
+        static_cast<uint32_t>(LEVEL_0_SLOTS + (NUMBER_OF_LEVELS - 1U) * LEVEL_N_SLOTS)};
+    /// @brief holds the timers which expired in the current tick and wait for the execution of their callback
+    static constexpr uint32_t EXPIRED_SLOT{NUMBER_OF_WHEEL_SLOTS};
+    static constexpr uint32_t NUMBER_OF_SLOTS{NUMBER_OF_WHEEL_SLOTS + 1U};
+    static constexpr uint32_t NO_SLOT{NUMBER_OF_SLOTS};
+    static constexpr uint64_t INFINITE_TICK{std::numeric_limits<uint64_t>::max()};
+
+    struct Entry
+    {
+        Callback_t callback;
+        uint64_t deadlineInNanoseconds{0U};
+        uint64_t periodInNanoseconds{0U};
+        uint64_t expiryTick{0U};
+        uint64_t overruns{0U};
+        CatchUpPolicy catchUpPolicy{CatchUpPolicy::SKIP_TO_NEXT_BEAT};
+        uint32_t generation{0U};
+        uint32_t next{INVALID_INDEX};
+        uint32_t previous{INVALID_INDEX};
+        uint32_t slot{NO_SLOT};
+        bool inUse{false};
+        bool isArmed{false};
+    };
+
+    void run() noexcept;
+    void sleepUntil(const uint64_t tick, std::unique_lock<std::mutex>& lock) noexcept;
+    void wakeUp() noexcept;
+    void processNextTick(std::unique_lock<std::mutex>& lock) noexcept;
+    void rearmPeriodicTimer(const uint32_t index,
+                            const uint64_t dueDeadline,
+                            std::unique_lock<std::mutex>& lock) noexcept;
+    void cascade(const uint64_t tick) noexcept;
+    uint64_t nextEventTick() const noexcept;
+
+    void insert(const uint32_t index) noexcept;
+    void link(const uint32_t index, const uint32_t slot) noexcept;
+    void unlink(const uint32_t index) noexcept;
+    void release(const uint32_t index) noexcept;
+    uint32_t slotFor(const uint64_t expiryTick) const noexcept;
+
+    bool isValid(const TimerId timerId) const noexcept;
+    uint64_t nanosecondsSinceStart() const noexcept;
+    uint64_t currentTick() const noexcept;
+    std::chrono::steady_clock::time_point tickToTimePoint(const uint64_t tick) const noexcept;
+
+  private:
+    uint64_t m_resolutionInNanoseconds;
+    std::chrono::steady_clock::time_point m_startTime{std::chrono::steady_clock::now()};
+
+    mutable std::mutex m_mutex;
+#if defined(__linux__)
+    int m_wakeupTimerFd{-1};
+    int m_wakeupEventFd{-1};
+#else
+    std::condition_variable m_wakeupCondition;
+#endif
+    std::condition_variable m_callbackFinishedCondition;
+
+    Entry m_entries[MAX_NUMBER_OF_TIMERS];
+    uint32_t m_slots[NUMBER_OF_SLOTS];
+    uint32_t m_freeListHead{0U};
+    uint32_t m_numberOfTimersInUse{0U};
+
+    /// @brief the last tick which was processed by the wheel thread
+    uint64_t m_currentTick{0U};
+    uint64_t m_scheduledWakeupTick{INFINITE_TICK};
+    uint32_t m_numberOfLinkedTimers{0U};
+    uint32_t m_executingIndex{INVALID_INDEX};
+    bool m_releaseExecutingTimer{false};
+    bool m_isSleeping{false};
+    bool m_keepRunning{true};
+
+    std::thread m_wheelThread;
+};
+
+} // namespace concurrent
+} // namespace iox
+
+#endif // IOX_HOOFS_CONCURRENT_TIMER_WHEEL_HPP
@@ -0,0 +1,94 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_HOOFS_POSIX_WRAPPER_BINARY_SEMAPHORE_HPP
+#define IOX_HOOFS_POSIX_WRAPPER_BINARY_SEMAPHORE_HPP
+
+#include "iceoryx_hoofs/cxx/expected.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/futex.hpp"
+#include "iceoryx_hoofs/internal/units/duration.hpp"
+#include "iceoryx_hoofs/posix_wrapper/semaphore.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace posix
+{
+/// @brief A semaphore which is either posted or not and which can be placed in shared memory to signal a waiter of
+///        another process. Posting an already posted BinarySemaphore has no effect.
+///        On Linux it is a futex word which contains the posted flag and the number of waiters, post() is a single
+///        atomic operation when no one waits and wait() only calls into the kernel when it has to block. On all other
+///        platforms it is an unnamed posix::Semaphore whose count is reduced to zero by reset().
+/// @code
+///   // process A, e.g. the ConditionListener
+///   semaphore.reset();
+///   if (!workAvailable()) semaphore.wait();
+///
+///   // process B, e.g. a ConditionNotifier
+///   publishWork();
+///   semaphore.post();
+/// @endcode
+class BinarySemaphore
+{
+  public:
+    BinarySemaphore() noexcept;
+    BinarySemaphore(const BinarySemaphore&) = delete;
+    BinarySemaphore(BinarySemaphore&&) = delete;
+    BinarySemaphore& operator=(const BinarySemaphore&) = delete;
+    BinarySemaphore& operator=(BinarySemaphore&&) = delete;
+    ~BinarySemaphore() = default;
+
+    /// @brief posts the semaphore and wakes up a waiter if there is one
+    /// @return SemaphoreError if the underlying semaphore is corrupted
+    cxx::expected<SemaphoreError> post() noexcept;
+
+    /// @brief blocks until the semaphore is posted and resets it afterwards
+    /// @return SemaphoreError if the underlying semaphore is corrupted
+    cxx::expected<SemaphoreError> wait() noexcept;
+
+    /// @brief like wait() but returns at latest after the given time
+    /// @param[in] timeToWait the maximum time to block
+    /// @return SemaphoreWaitState::TIMEOUT when the semaphore was not posted within timeToWait, the semaphore is not
+    ///         reset in this case, or SemaphoreError if the underlying semaphore is corrupted
+    cxx::expected<SemaphoreWaitState, SemaphoreError> timedWait(const units::Duration& timeToWait) noexcept;
+
+    /// @brief resets the semaphore without blocking
+    /// @return SemaphoreError if the underlying semaphore is corrupted
+    cxx::expected<SemaphoreError> reset() noexcept;
+
+    /// @brief returns true if the semaphore is posted
+    /// @return SemaphoreError if the underlying semaphore is corrupted
+    cxx::expected<bool, SemaphoreError> isPosted() const noexcept;
+
+  private:
+#if defined(__linux__)
+    static constexpr uint32_t POSTED{1U};
+    /// @brief every waiter adds WAITER to the futex word, the bits above POSTED count the waiters
+    static constexpr uint32_t WAITER{2U};
+
+    cxx::expected<SemaphoreWaitState, SemaphoreError> waitUntilPosted(const struct timespec* absoluteTimeout) noexcept;
+
+    std::atomic<uint32_t> m_futex{0U};
+#else
+    Semaphore m_semaphore;
+#endif
+};
+
+} // namespace posix
+} // namespace iox
+
+#endif // IOX_HOOFS_POSIX_WRAPPER_BINARY_SEMAPHORE_HPP
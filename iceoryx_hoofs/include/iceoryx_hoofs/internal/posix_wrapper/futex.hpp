@@ -0,0 +1,79 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_HOOFS_POSIX_WRAPPER_FUTEX_HPP
+#define IOX_HOOFS_POSIX_WRAPPER_FUTEX_HPP
+
+#include "iceoryx_hoofs/cxx/expected.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <time.h>
+
+namespace iox
+{
+namespace posix
+{
+#if defined(__linux__)
+/// @brief true on platforms which provide a futex, the functions below are only available there
+constexpr bool IS_FUTEX_AVAILABLE{true};
+
+enum class FutexError
+{
+    INVALID_STATE,
+    INVALID_ARGUMENT,
+    UNDEFINED
+};
+
+enum class FutexWaitState
+{
+    /// @brief the futex was woken up, the value did not match or the wait was interrupted; the futex word has to
+    ///        be checked again by the caller
+    WOKEN_UP,
+    TIMEOUT
+};
+
+/// @brief Blocks until the futex word is woken up by futexWake, as long as it contains the expected value. The futex
+///        word can be located in shared memory, it is used by all processes which map the memory.
+/// @param[in] futexWord which is checked atomically against the expected value before blocking
+/// @param[in] expectedValue the wait returns immediately if the futex word does not contain this value
+/// @return the wait state or FutexError when the futex word is invalid
+cxx::expected<FutexWaitState, FutexError> futexWait(std::atomic<uint32_t>& futexWord,
+                                                    const uint32_t expectedValue) noexcept;
+
+/// @brief like futexWait but returns at latest at the given time
+/// @param[in] futexWord which is checked atomically against the expected value before blocking
+/// @param[in] expectedValue the wait returns immediately if the futex word does not contain this value
+/// @param[in] absoluteTimeout CLOCK_MONOTONIC time, e.g. units::Duration::timespec(TimeSpecReference::Monotonic);
+///            it does not need to be adjusted when the wait is repeated after a spurious wakeup
+/// @return the wait state or FutexError when the futex word is invalid
+cxx::expected<FutexWaitState, FutexError> futexTimedWait(std::atomic<uint32_t>& futexWord,
+                                                         const uint32_t expectedValue,
+                                                         const struct timespec& absoluteTimeout) noexcept;
+
+/// @brief wakes up threads which are waiting on the futex word
+/// @param[in] futexWord on which the threads are waiting
+/// @param[in] numberOfWaiters the maximum number of threads which are woken up
+/// @return the number of threads which were woken up or FutexError when the futex word is invalid
+cxx::expected<uint32_t, FutexError> futexWake(std::atomic<uint32_t>& futexWord,
+                                              const uint32_t numberOfWaiters) noexcept;
+#else
+constexpr bool IS_FUTEX_AVAILABLE{false};
+#endif
+
+} // namespace posix
+} // namespace iox
+
+#endif // IOX_HOOFS_POSIX_WRAPPER_FUTEX_HPP
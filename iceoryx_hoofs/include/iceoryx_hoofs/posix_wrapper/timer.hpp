@@ -20,8 +20,8 @@
 #include "iceoryx_hoofs/cxx/optional.hpp"
 #include "iceoryx_hoofs/cxx/vector.hpp"
 #include "iceoryx_hoofs/design_pattern/creation.hpp"
+#include "iceoryx_hoofs/internal/concurrent/timer_wheel.hpp"
 #include "iceoryx_hoofs/internal/units/duration.hpp"
-#include "iceoryx_hoofs/platform/signal.hpp"
 #include "iceoryx_hoofs/platform/time.hpp"
 
 #include <atomic>
@@ -56,8 +56,8 @@ using namespace iox::units::duration_literals;
 
 
 /// @brief Interface for timers on POSIX operating systems
-/// @note Can't be copied or moved as operating system has a pointer to this object. It needs to be ensured that this
-/// object lives longer than timeToWait, otherwise the operating system will unregister the timer
+/// @note Can't be copied or moved as the TimerWheel has a pointer to this object. It needs to be ensured that this
+/// object lives longer than timeToWait, otherwise the TimerWheel will unregister the timer
 /// @concurrent not thread safe
 ///
 /// @code
@@ -74,8 +74,8 @@ using namespace iox::units::duration_literals;
 
 /// This class will be DEPRECATED in the near future. In its current form there may still be potential races when
 /// start/stop/restart are called concurrently (this includes the callback, which is executed in a separate thread).
-/// The implementation also has too much overhead in the callback execution (due to execution logic and potentially
-/// multiple callback threads).
+/// The callbacks of all timers are executed sequentially in the thread of the process wide concurrent::TimerWheel,
+/// therefore a callback must not block.
 ///
 /// It will be replaced with simpler versions for individual use cases, such as a CountdownTimer which can be used for
 /// watchdog/keepalive purposes.
@@ -94,7 +94,7 @@ class Timer
     ///     SKIP_TO_NEXT_BEAT skip callback and call it in the next cycle
     ///     IMMEDIATE call the callback right after the currently running callback is finished
     ///     TERMINATE terminates the process by calling the errorHandler with
-    ///                 POSIX_TIMER__CALLBACK_RUNTIME_EXCEEDS_RETRIGGER_TIME
+    ///                 TIMER_WHEEL__CALLBACK_RUNTIME_EXCEEDS_PERIOD
     enum class CatchUpPolicy
     {
         SKIP_TO_NEXT_BEAT,
@@ -103,49 +103,10 @@ class Timer
     };
 
   private:
-    static constexpr size_t SIZE_OF_COMBINDED_INDEX_AND_DESCRIPTOR = sizeof(uint32_t);
-    static constexpr size_t SIZE_OF_SIGVAL_INT = sizeof(int);
-    static_assert(SIZE_OF_SIGVAL_INT >= SIZE_OF_COMBINDED_INDEX_AND_DESCRIPTOR, "size of sigval_int is to low");
-
-    static constexpr uint32_t MAX_NUMBER_OF_CALLBACK_HANDLES = 100u;
-    static_assert(MAX_NUMBER_OF_CALLBACK_HANDLES <= std::numeric_limits<uint8_t>::max(),
-                  "number of callback handles exceeds max index value");
-    class OsTimer;
-    struct OsTimerCallbackHandle
-    {
-        static constexpr uint32_t MAX_DESCRIPTOR_VALUE{(1u << 24u) - 1u};
-        static sigval indexAndDescriptorToSigval(uint8_t index, uint32_t descriptor) noexcept;
-        static uint8_t sigvalToIndex(sigval intVal) noexcept;
-        static uint32_t sigvalToDescriptor(sigval intVal) noexcept;
-
-        void incrementDescriptor() noexcept;
-
-        std::mutex m_accessMutex;
-
-        /// @brief the descriptor is unique for a timer_t in OsTimer, if this handle is recycled, the descriptor needs
-        /// to be incremented first
-        std::atomic<uint32_t> m_descriptor{0u};
-        std::atomic_flag m_callbackIsAboutToBeExecuted{false};
-
-        std::atomic<bool> m_inUse{false};
-        std::atomic<bool> m_isTimerActive{false};
-        std::atomic<uint64_t> m_timerInvocationCounter{0u};
-        CatchUpPolicy m_catchUpPolicy{CatchUpPolicy::TERMINATE};
-        OsTimer* m_timer{nullptr};
-    };
-
     /// This class will be DEPRECATED in the near future.
     class OsTimer
     {
-#ifdef __QNX__
-        static constexpr timer_t INVALID_TIMER_ID = 0;
-#else
-        static constexpr timer_t INVALID_TIMER_ID = nullptr;
-#endif
       public:
-        /// @brief Wrapper that can be registered with the operating system
-        static void callbackHelper(sigval data);
-
         OsTimer(const units::Duration timeToWait, const std::function<void()>& callback) noexcept;
 
         OsTimer(const OsTimer&) = delete;
@@ -158,7 +119,7 @@ class Timer
 
         /// @brief Starts the timer
         ///
-        /// The callback is called by the operating system after the time has expired.
+        /// The callback is called by the process wide TimerWheel after the time has expired.
         ///
         /// @param[in] runMode can be a periodic timer if set to RunMode::PERIODIC or
         ///                     it runs just once when it is set to RunMode::ONCE
@@ -183,8 +144,8 @@ class Timer
         /// @note Shall only be called when callback is given
         cxx::expected<units::Duration, TimerError> timeUntilExpiration() noexcept;
 
-        /// @brief In case the callback is not immediately called by the operating system, getOverruns() returns the
-        /// additional overruns that happended in the delay interval
+        /// @brief In case the callback of a periodic timer took longer than the period, getOverruns() returns the
+        /// number of expirations which were missed in the delay interval
         /// @note Shall only be called when callback is given
         cxx::expected<uint64_t, TimerError> getOverruns() noexcept;
 
@@ -196,7 +157,7 @@ class Timer
 
       private:
         /// @brief Call the user-defined callback
-        /// @note This call is wrapped in a plain C function
+        /// @note This call is executed in the thread of the TimerWheel
         void executeCallback() noexcept;
 
       private:
@@ -206,10 +167,8 @@ class Timer
         /// @brief Stores the user-defined callback
         std::function<void()> m_callback;
 
-        /// @brief Identifier for the timer in the operating system
-        timer_t m_timerId{INVALID_TIMER_ID};
-
-        uint8_t m_callbackHandleIndex{0u};
+        /// @brief Identifier for the timer in the process wide TimerWheel
+        concurrent::TimerWheel::TimerId m_timerId;
 
         /// @todo will be obsolete with creation pattern
         /// @brief Bool that signals whether the object is fully initalized
@@ -218,8 +177,6 @@ class Timer
         /// @todo creation pattern
         /// @brief If an error happened during creation the value is stored in here
         TimerError m_errorValue{TimerError::NO_ERROR};
-
-        static OsTimerCallbackHandle s_callbackHandlePool[MAX_NUMBER_OF_CALLBACK_HANDLES];
     };
 
   public:
@@ -241,7 +198,7 @@ class Timer
     /// @param[in] timeToWait - How long should be waited?
     /// @param[in] callback - Function called after timeToWait (User needs to ensure lifetime of function till stop()
     ///                       call)
-    /// @note Operating systems needs a valid reference to this object, hence DesignPattern::Creation can't be used
+    /// @note The TimerWheel needs a valid reference to this object, hence DesignPattern::Creation can't be used
     Timer(const units::Duration timeToWait, const std::function<void()>& callback) noexcept;
 
     /// @brief creates Duration from the result of clock_gettime(CLOCK_REALTIME, ...)
@@ -266,7 +223,7 @@ class Timer
 
     /// @brief Starts the timer
     ///
-    /// The callback is called by the operating system after the time has expired.
+    /// The callback is called by the process wide TimerWheel after the time has expired.
     ///
     /// @param[in] runMode for continuous callbacks PERIODIC otherwise ONCE
     /// @param[in] CatchUpPolicy define behavior when callbackRuntime > timeToWait
@@ -290,8 +247,8 @@ class Timer
     /// @note Shall only be called when callback is given
     cxx::expected<units::Duration, TimerError> timeUntilExpiration() noexcept;
 
-    /// @brief In case the callback is not immediately called by the operating system, getOverruns() returns the
-    /// additional overruns that happended in the delay interval
+    /// @brief In case the callback of a periodic timer took longer than the period, getOverruns() returns the
+    /// number of expirations which were missed in the delay interval
     /// @note Shall only be called when callback is given
     cxx::expected<uint64_t, TimerError> getOverruns() noexcept;
 
@@ -31,6 +31,8 @@ constexpr bool IOX_SHM_WRITE_ZEROS_ON_CREATION = true;
 constexpr const char IOX_PATH_SEPARATORS[] = "/";
 constexpr uint64_t IOX_UDS_SOCKET_MAX_MESSAGE_SIZE = 4096;
 constexpr char IOX_UDS_SOCKET_PATH_PREFIX[] = "/tmp/";
+/// @brief used to place data which is written by different cores on separate cache lines
+constexpr uint64_t IOX_CACHE_LINE_SIZE = 64U;
 using IoxIpcChannelType = iox::posix::UnixDomainSocket;
 } // namespace platform
 } // namespace iox
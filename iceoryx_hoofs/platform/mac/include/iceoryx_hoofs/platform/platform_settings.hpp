@@ -31,6 +31,13 @@ constexpr bool IOX_SHM_WRITE_ZEROS_ON_CREATION = true;
 constexpr const char IOX_PATH_SEPARATORS[] = "/";
 constexpr uint64_t IOX_UDS_SOCKET_MAX_MESSAGE_SIZE = 2048;
 constexpr char IOX_UDS_SOCKET_PATH_PREFIX[] = "/tmp/";
+/// @brief used to place data which is written by different cores on separate cache lines
+#if defined(__aarch64__) || defined(__arm64__)
+// Apple silicon has cache lines of 128 bytes
+constexpr uint64_t IOX_CACHE_LINE_SIZE = 128U;
+#else
+constexpr uint64_t IOX_CACHE_LINE_SIZE = 64U;
+#endif
 using IoxIpcChannelType = iox::posix::UnixDomainSocket;
 } // namespace platform
 } // namespace iox
@@ -34,6 +34,8 @@ constexpr const char IOX_PATH_SEPARATORS[] = "\\/";
 // so that the code with stub implementation at least compiles
 constexpr uint64_t IOX_UDS_SOCKET_MAX_MESSAGE_SIZE = 1024U;
 constexpr char IOX_UDS_SOCKET_PATH_PREFIX[] = "";
+/// @brief used to place data which is written by different cores on separate cache lines
+constexpr uint64_t IOX_CACHE_LINE_SIZE = 64U;
 using IoxIpcChannelType = iox::posix::NamedPipe;
 
 namespace win32
@@ -0,0 +1,596 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/concurrent/timer_wheel.hpp"
+#include "iceoryx_hoofs/error_handling/error_handling.hpp"
+#include "iceoryx_hoofs/posix_wrapper/posix_call.hpp"
+
+#include <algorithm>
+#include <new>
+
+#if defined(__linux__)
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+#endif
+
+namespace iox
+{
+namespace concurrent
+{
+constexpr uint32_t TimerWheel::MAX_NUMBER_OF_TIMERS;
+constexpr units::Duration TimerWheel::DEFAULT_RESOLUTION;
+constexpr uint32_t TimerWheel::INVALID_INDEX;
+constexpr uint64_t TimerWheel::LEVEL_0_BITS;
+constexpr uint64_t TimerWheel::LEVEL_N_BITS;
+constexpr uint64_t TimerWheel::NUMBER_OF_LEVELS;
+constexpr uint64_t TimerWheel::LEVEL_0_SLOTS;
+constexpr uint64_t TimerWheel::LEVEL_N_SLOTS;
+constexpr uint32_t TimerWheel::NUMBER_OF_WHEEL_SLOTS;
+constexpr uint32_t TimerWheel::EXPIRED_SLOT;
+constexpr uint32_t TimerWheel::NUMBER_OF_SLOTS;
+constexpr uint32_t TimerWheel::NO_SLOT;
+constexpr uint64_t TimerWheel::INFINITE_TICK;
+
+TimerWheel& TimerWheel::instance() noexcept
+{
+    // the wheel is intentionally leaked; objects with static storage duration which own a timer are destroyed after
+    // a function local static and would otherwise remove their timer from a destroyed wheel
+    static typename std::aligned_storage<sizeof(TimerWheel), alignof(TimerWheel)>::type storage;
+    static TimerWheel* timerWheel = new (&storage) TimerWheel();
+    return *timerWheel;
+}
+
+TimerWheel::TimerWheel(const units::Duration resolution, const posix::ThreadName_t& threadName) noexcept
+    : m_resolutionInNanoseconds(std::max<uint64_t>(resolution.toNanoseconds(), 1U))
+{
+#if defined(__linux__)
+    posix::posixCall(timerfd_create)(CLOCK_MONOTONIC, TFD_CLOEXEC | TFD_NONBLOCK)
+        .failureReturnValue(-1)
+        .evaluate()
+        .and_then([this](auto& r) { m_wakeupTimerFd = r.value; })
+        .or_else([](auto&) { errorHandler(Error::kTIMER_WHEEL__UNABLE_TO_CREATE_WAKEUP_TIMER); });
+    posix::posixCall(eventfd)(0U, EFD_CLOEXEC | EFD_NONBLOCK)
+        .failureReturnValue(-1)
+        .evaluate()
+        .and_then([this](auto& r) { m_wakeupEventFd = r.value; })
+        .or_else([](auto&) { errorHandler(Error::kTIMER_WHEEL__UNABLE_TO_CREATE_WAKEUP_TIMER); });
+#endif
+
+    for (uint32_t i = 0U; i < MAX_NUMBER_OF_TIMERS; ++i)
+    {
+        m_entries[i].next = i + 1U;
+    }
+    for (auto& slot : m_slots)
+    {
+        slot = INVALID_INDEX;
+    }
+
+    m_wheelThread = std::thread(&TimerWheel::run, this);
+    posix::setThreadName(m_wheelThread.native_handle(), threadName);
+}
+
+TimerWheel::~TimerWheel() noexcept
+{
+    bool hasTimersInUse{false};
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_keepRunning = false;
+        hasTimersInUse = (m_numberOfTimersInUse != 0U);
+    }
+    wakeUp();
+    m_wheelThread.join();
+
+#if defined(__linux__)
+    IOX_DISCARD_RESULT(posix::posixCall(close)(m_wakeupTimerFd).failureReturnValue(-1).evaluate());
+    IOX_DISCARD_RESULT(posix::posixCall(close)(m_wakeupEventFd).failureReturnValue(-1).evaluate());
+#endif
+
+    if (hasTimersInUse)
+    {
+        errorHandler(Error::kTIMER_WHEEL__DESTROYED_WITH_TIMERS_IN_USE);
+    }
+}
+
+cxx::expected<TimerWheel::TimerId, TimerWheelError> TimerWheel::add(const Callback_t& callback) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_freeListHead == INVALID_INDEX)
+    {
+        return cxx::error<TimerWheelError>(TimerWheelError::TIMER_LIMIT_REACHED);
+    }
+
+    const uint32_t index = m_freeListHead;
+    auto& entry = m_entries[index];
+    m_freeListHead = entry.next;
+
+    entry.callback = callback;
+    entry.next = INVALID_INDEX;
+    entry.previous = INVALID_INDEX;
+    entry.slot = NO_SLOT;
+    entry.overruns = 0U;
+    entry.isArmed = false;
+    entry.inUse = true;
+    ++m_numberOfTimersInUse;
+
+    return cxx::success<TimerId>(TimerId{index, entry.generation});
+}
+
+cxx::expected<TimerWheelError> TimerWheel::arm(const TimerId timerId,
+                                               const units::Duration timeToWait,
+                                               const units::Duration period,
+                                               const CatchUpPolicy catchUpPolicy) noexcept
+{
+    if (timeToWait.toNanoseconds() == 0U)
+    {
+        return cxx::error<TimerWheelError>(TimerWheelError::TIMEOUT_IS_ZERO);
+    }
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (!isValid(timerId))
+    {
+        return cxx::error<TimerWheelError>(TimerWheelError::INVALID_TIMER_ID);
+    }
+
+    auto& entry = m_entries[timerId.index];
+    if (entry.slot != NO_SLOT)
+    {
+        unlink(timerId.index);
+    }
+
+    // without linked timers the wheel thread does not advance the current tick; it is synchronized here, otherwise
+    // the wheel thread would have to catch up with all ticks which passed while it was idle
+    if (m_numberOfLinkedTimers == 0U)
+    {
+        m_currentTick = std::max(m_currentTick, currentTick());
+    }
+
+    entry.deadlineInNanoseconds = nanosecondsSinceStart() + timeToWait.toNanoseconds();
+    entry.periodInNanoseconds = period.toNanoseconds();
+    entry.catchUpPolicy = catchUpPolicy;
+    entry.overruns = 0U;
+    entry.isArmed = true;
+    insert(timerId.index);
+
+    const bool wakeupRequired = m_isSleeping && entry.expiryTick < m_scheduledWakeupTick;
+    lock.unlock();
+
+    if (wakeupRequired)
+    {
+        wakeUp();
+    }
+
+    return cxx::success<>();
+}
+
+cxx::expected<TimerWheelError> TimerWheel::disarm(const TimerId timerId) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!isValid(timerId))
+    {
+        return cxx::error<TimerWheelError>(TimerWheelError::INVALID_TIMER_ID);
+    }
+
+    auto& entry = m_entries[timerId.index];
+    if (entry.slot != NO_SLOT)
+    {
+        unlink(timerId.index);
+    }
+    entry.isArmed = false;
+
+    return cxx::success<>();
+}
+
+cxx::expected<TimerWheelError> TimerWheel::remove(const TimerId timerId) noexcept
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (!isValid(timerId))
+    {
+        return cxx::error<TimerWheelError>(TimerWheelError::INVALID_TIMER_ID);
+    }
+
+    auto& entry = m_entries[timerId.index];
+    if (entry.slot != NO_SLOT)
+    {
+        unlink(timerId.index);
+    }
+    entry.isArmed = false;
+
+    entry.inUse = false;
+    ++entry.generation;
+
+    // the callback must not be destroyed while it is running; when remove is called from the callback itself, the
+    // wheel thread releases the timer after the callback has returned
+    if (std::this_thread::get_id() == m_wheelThread.get_id() && m_executingIndex == timerId.index)
+    {
+        m_releaseExecutingTimer = true;
+        return cxx::success<>();
+    }
+    m_callbackFinishedCondition.wait(lock, [&] { return m_executingIndex != timerId.index; });
+
+    release(timerId.index);
+
+    return cxx::success<>();
+}
+
+cxx::expected<units::Duration, TimerWheelError> TimerWheel::timeUntilExpiration(const TimerId timerId) const noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!isValid(timerId))
+    {
+        return cxx::error<TimerWheelError>(TimerWheelError::INVALID_TIMER_ID);
+    }
+
+    const auto& entry = m_entries[timerId.index];
+    const uint64_t now = nanosecondsSinceStart();
+    if (entry.slot == NO_SLOT || entry.slot == EXPIRED_SLOT || entry.deadlineInNanoseconds <= now)
+    {
+        return cxx::success<units::Duration>(units::Duration::fromNanoseconds(0U));
+    }
+
+    return cxx::success<units::Duration>(units::Duration::fromNanoseconds(entry.deadlineInNanoseconds - now));
+}
+
+cxx::expected<uint64_t, TimerWheelError> TimerWheel::getOverruns(const TimerId timerId) const noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!isValid(timerId))
+    {
+        return cxx::error<TimerWheelError>(TimerWheelError::INVALID_TIMER_ID);
+    }
+
+    return cxx::success<uint64_t>(m_entries[timerId.index].overruns);
+}
+
+cxx::expected<bool, TimerWheelError> TimerWheel::isArmed(const TimerId timerId) const noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!isValid(timerId))
+    {
+        return cxx::error<TimerWheelError>(TimerWheelError::INVALID_TIMER_ID);
+    }
+
+    return cxx::success<bool>(m_entries[timerId.index].isArmed);
+}
+
+void TimerWheel::run() noexcept
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (m_keepRunning)
+    {
+        const uint64_t nowTick = currentTick();
+
+        if (m_numberOfLinkedTimers == 0U)
+        {
+            // nothing to do; the ticks are skipped instead of processed one after another after the wakeup
+            m_currentTick = std::max(m_currentTick, nowTick);
+            m_scheduledWakeupTick = INFINITE_TICK;
+            sleepUntil(m_scheduledWakeupTick, lock);
+            continue;
+        }
+
+        if (m_currentTick < nowTick)
+        {
+            processNextTick(lock);
+            continue;
+        }
+
+        m_scheduledWakeupTick = nextEventTick();
+        sleepUntil(m_scheduledWakeupTick, lock);
+    }
+}
+
+#if defined(__linux__)
+void TimerWheel::sleepUntil(const uint64_t tick, std::unique_lock<std::mutex>& lock) noexcept
+{
+    // the timerfd is armed with an absolute CLOCK_MONOTONIC time, the kernel wakes the thread with hrtimer precision
+    // and the deadline does not drift when the thread is woken up earlier; steady_clock is CLOCK_MONOTONIC on Linux
+    struct itimerspec wakeupTime
+    {
+    };
+    if (tick != INFINITE_TICK)
+    {
+        auto wakeupTimePoint = tickToTimePoint(tick).time_since_epoch();
+        auto seconds = std::chrono::duration_cast<std::chrono::seconds>(wakeupTimePoint);
+        wakeupTime.it_value.tv_sec = static_cast<time_t>(seconds.count());
+        wakeupTime.it_value.tv_nsec =
+            static_cast<long>(std::chrono::duration_cast<std::chrono::nanoseconds>(wakeupTimePoint - seconds).count());
+    }
+    IOX_DISCARD_RESULT(posix::posixCall(timerfd_settime)(m_wakeupTimerFd, TFD_TIMER_ABSTIME, &wakeupTime, nullptr)
+                           .failureReturnValue(-1)
+                           .evaluate());
+
+    m_isSleeping = true;
+    lock.unlock();
+
+    // the eventfd is a counter, a wakeup which is signaled before poll is called is therefore not lost
+    struct pollfd fds[2] = {{m_wakeupTimerFd, POLLIN, 0}, {m_wakeupEventFd, POLLIN, 0}};
+    IOX_DISCARD_RESULT(posix::posixCall(poll)(fds, 2U, -1).failureReturnValue(-1).ignoreErrnos(EINTR).evaluate());
+
+    uint64_t counter{0U};
+    IOX_DISCARD_RESULT(posix::posixCall(read)(m_wakeupTimerFd, &counter, sizeof(counter))
+                           .failureReturnValue(-1)
+                           .ignoreErrnos(EAGAIN)
+                           .evaluate());
+    IOX_DISCARD_RESULT(posix::posixCall(read)(m_wakeupEventFd, &counter, sizeof(counter))
+                           .failureReturnValue(-1)
+                           .ignoreErrnos(EAGAIN)
+                           .evaluate());
+
+    lock.lock();
+    m_isSleeping = false;
+}
+
+void TimerWheel::wakeUp() noexcept
+{
+    constexpr uint64_t INCREMENT{1U};
+    IOX_DISCARD_RESULT(
+        posix::posixCall(write)(m_wakeupEventFd, &INCREMENT, sizeof(INCREMENT)).failureReturnValue(-1).evaluate());
+}
+#else
+void TimerWheel::sleepUntil(const uint64_t tick, std::unique_lock<std::mutex>& lock) noexcept
+{
+    m_isSleeping = true;
+    if (tick == INFINITE_TICK)
+    {
+        m_wakeupCondition.wait(lock);
+    }
+    else
+    {
+        m_wakeupCondition.wait_until(lock, tickToTimePoint(tick));
+    }
+    m_isSleeping = false;
+}
+
+void TimerWheel::wakeUp() noexcept
+{
+    m_wakeupCondition.notify_one();
+}
+#endif
+
+void TimerWheel::processNextTick(std::unique_lock<std::mutex>& lock) noexcept
+{
+    const uint64_t tick = m_currentTick + 1U;
+    cascade(tick);
+    m_currentTick = tick;
+
+    // move the expired timers to the expired slot; this way a concurrent disarm can still unlink them
+    const uint32_t level0Slot = static_cast<uint32_t>(tick & (LEVEL_0_SLOTS - 1U));
+    while (m_slots[level0Slot] != INVALID_INDEX)
+    {
+        const uint32_t index = m_slots[level0Slot];
+        unlink(index);
+        link(index, EXPIRED_SLOT);
+    }
+
+    while (m_slots[EXPIRED_SLOT] != INVALID_INDEX)
+    {
+        const uint32_t index = m_slots[EXPIRED_SLOT];
+        unlink(index);
+
+        auto& entry = m_entries[index];
+        const uint64_t dueDeadline = entry.deadlineInNanoseconds;
+        if (entry.periodInNanoseconds == 0U)
+        {
+            entry.isArmed = false;
+        }
+
+        m_executingIndex = index;
+        lock.unlock();
+        entry.callback();
+        lock.lock();
+        m_executingIndex = INVALID_INDEX;
+        m_callbackFinishedCondition.notify_all();
+
+        if (m_releaseExecutingTimer)
+        {
+            m_releaseExecutingTimer = false;
+            release(index);
+            continue;
+        }
+
+        // a timer which was disarmed or re-armed while its callback was running must not be touched
+        if (entry.inUse && entry.isArmed && entry.slot == NO_SLOT && entry.periodInNanoseconds != 0U)
+        {
+            rearmPeriodicTimer(index, dueDeadline, lock);
+        }
+    }
+}
+
+void TimerWheel::rearmPeriodicTimer(const uint32_t index,
+                                    const uint64_t dueDeadline,
+                                    std::unique_lock<std::mutex>& lock) noexcept
+{
+    auto& entry = m_entries[index];
+    const uint64_t period = entry.periodInNanoseconds;
+    const uint64_t now = nanosecondsSinceStart();
+    uint64_t nextDeadline = dueDeadline + period;
+    bool hasExceededPeriod = false;
+
+    entry.overruns = 0U;
+    if (nextDeadline <= now)
+    {
+        entry.overruns = (now - dueDeadline) / period;
+        switch (entry.catchUpPolicy)
+        {
+        case CatchUpPolicy::IMMEDIATE:
+            nextDeadline = now;
+            break;
+        case CatchUpPolicy::TERMINATE:
+            hasExceededPeriod = true;
+            nextDeadline = dueDeadline + (entry.overruns + 1U) * period;
+            break;
+        case CatchUpPolicy::SKIP_TO_NEXT_BEAT:
+            nextDeadline = dueDeadline + (entry.overruns + 1U) * period;
+            break;
+        }
+    }
+
+    entry.deadlineInNanoseconds = nextDeadline;
+    insert(index);
+
+    if (hasExceededPeriod)
+    {
+        lock.unlock();
+        errorHandler(Error::kTIMER_WHEEL__CALLBACK_RUNTIME_EXCEEDS_PERIOD);
+        lock.lock();
+    }
+}
+
+void TimerWheel::cascade(const uint64_t tick) noexcept
+{
+    // the outer levels are cascaded first so that their timers can be distributed further down in the same tick
+    for (uint64_t level = NUMBER_OF_LEVELS - 1U; level > 0U; --level)
+    {
+        const uint64_t shift = LEVEL_0_BITS + (level - 1U) * LEVEL_N_BITS;
+        if ((tick & ((1ULL << shift) - 1U)) != 0U)
+        {
+            continue;
+        }
+
+        const uint32_t slot = static_cast<uint32_t>(LEVEL_0_SLOTS + (level - 1U) * LEVEL_N_SLOTS
+                                                    + ((tick >> shift) & (LEVEL_N_SLOTS - 1U)));
+        uint32_t index = m_slots[slot];
+        m_slots[slot] = INVALID_INDEX;
+        while (index != INVALID_INDEX)
+        {
+            const uint32_t next = m_entries[index].next;
+            m_entries[index].slot = NO_SLOT;
+            --m_numberOfLinkedTimers;
+            insert(index);
+            index = next;
+        }
+    }
+}
+
+uint64_t TimerWheel::nextEventTick() const noexcept
+{
+    // the timers in level 0 expire within the next LEVEL_0_SLOTS ticks; the outer levels need to be cascaded when
+    // level 0 wraps around, therefore the search can stop there
+    for (uint64_t tick = m_currentTick + 1U; tick <= m_currentTick + LEVEL_0_SLOTS; ++tick)
+    {
+        const uint64_t level0Slot = tick & (LEVEL_0_SLOTS - 1U);
+        if (m_slots[level0Slot] != INVALID_INDEX || level0Slot == 0U)
+        {
+            return tick;
+        }
+    }
+    return m_currentTick + LEVEL_0_SLOTS;
+}
+
+void TimerWheel::insert(const uint32_t index) noexcept
+{
+    // the expiration is rounded up to the next tick, therefore a timer never fires prematurely
+    auto& entry = m_entries[index];
+    const uint64_t expiryTick =
+        (entry.deadlineInNanoseconds + m_resolutionInNanoseconds - 1U) / m_resolutionInNanoseconds;
+    entry.expiryTick = std::max(expiryTick, m_currentTick + 1U);
+    link(index, slotFor(entry.expiryTick));
+}
+
+uint32_t TimerWheel::slotFor(const uint64_t expiryTick) const noexcept
+{
+    if (expiryTick - m_currentTick <= LEVEL_0_SLOTS)
+    {
+        return static_cast<uint32_t>(expiryTick & (LEVEL_0_SLOTS - 1U));
+    }
+
+    uint64_t shift = LEVEL_0_BITS;
+    for (uint64_t level = 1U; level < NUMBER_OF_LEVELS; ++level, shift += LEVEL_N_BITS)
+    {
+        if ((expiryTick >> shift) - (m_currentTick >> shift) <= LEVEL_N_SLOTS)
+        {
+            return static_cast<uint32_t>(LEVEL_0_SLOTS + (level - 1U) * LEVEL_N_SLOTS
+                                         + ((expiryTick >> shift) & (LEVEL_N_SLOTS - 1U)));
+        }
+    }
+
+    // beyond the range of the wheel; the timer is parked in the slot of the outermost level which is cascaded last
+    // and re-inserted from there until its expiration is in range
+    shift -= LEVEL_N_BITS;
+    return static_cast<uint32_t>(LEVEL_0_SLOTS + (NUMBER_OF_LEVELS - 2U) * LEVEL_N_SLOTS
+                                 + (((m_currentTick >> shift) + LEVEL_N_SLOTS) & (LEVEL_N_SLOTS - 1U)));
+}
+
+void TimerWheel::link(const uint32_t index, const uint32_t slot) noexcept
+{
+    auto& entry = m_entries[index];
+    entry.slot = slot;
+    entry.previous = INVALID_INDEX;
+    entry.next = m_slots[slot];
+    if (entry.next != INVALID_INDEX)
+    {
+        m_entries[entry.next].previous = index;
+    }
+    m_slots[slot] = index;
+    ++m_numberOfLinkedTimers;
+}
+
+void TimerWheel::unlink(const uint32_t index) noexcept
+{
+    auto& entry = m_entries[index];
+    if (entry.previous != INVALID_INDEX)
+    {
+        m_entries[entry.previous].next = entry.next;
+    }
+    else
+    {
+        m_slots[entry.slot] = entry.next;
+    }
+    if (entry.next != INVALID_INDEX)
+    {
+        m_entries[entry.next].previous = entry.previous;
+    }
+    entry.next = INVALID_INDEX;
+    entry.previous = INVALID_INDEX;
+    entry.slot = NO_SLOT;
+    --m_numberOfLinkedTimers;
+}
+
+void TimerWheel::release(const uint32_t index) noexcept
+{
+    auto& entry = m_entries[index];
+    --m_numberOfTimersInUse;
+    entry.callback = Callback_t();
+    entry.next = m_freeListHead;
+    m_freeListHead = index;
+}
+
+bool TimerWheel::isValid(const TimerId timerId) const noexcept
+{
+    return timerId.index < MAX_NUMBER_OF_TIMERS && m_entries[timerId.index].inUse
+           && m_entries[timerId.index].generation == timerId.generation;
+}
+
+uint64_t TimerWheel::nanosecondsSinceStart() const noexcept
+{
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_startTime);
+    return static_cast<uint64_t>(elapsed.count());
+}
+
+uint64_t TimerWheel::currentTick() const noexcept
+{
+    return nanosecondsSinceStart() / m_resolutionInNanoseconds;
+}
+
+std::chrono::steady_clock::time_point TimerWheel::tickToTimePoint(const uint64_t tick) const noexcept
+{
+    return m_startTime + std::chrono::nanoseconds(tick * m_resolutionInNanoseconds);
+}
+
+} // namespace concurrent
+} // namespace iox
@@ -0,0 +1,173 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/posix_wrapper/binary_semaphore.hpp"
+#include "iceoryx_hoofs/error_handling/error_handling.hpp"
+
+namespace iox
+{
+namespace posix
+{
+#if defined(__linux__)
+namespace
+{
+SemaphoreError futexErrorToSemaphoreError(const FutexError error) noexcept
+{
+    return (error == FutexError::INVALID_ARGUMENT) ? SemaphoreError::INVALID_SEMAPHORE_HANDLE : SemaphoreError::UNDEFINED;
+}
+} // namespace
+
+constexpr uint32_t BinarySemaphore::POSTED;
+constexpr uint32_t BinarySemaphore::WAITER;
+
+BinarySemaphore::BinarySemaphore() noexcept
+{
+}
+
+cxx::expected<SemaphoreError> BinarySemaphore::post() noexcept
+{
+    auto previousValue = m_futex.fetch_or(POSTED, std::memory_order_acq_rel);
+    // a waiter registers itself before it checks POSTED, if it is not registered yet it will see POSTED without
+    // blocking; if POSTED was already set the waiters have been woken up by the previous post
+    if ((previousValue & POSTED) == 0U && previousValue >= WAITER)
+    {
+        auto wakeResult = futexWake(m_futex, 1U);
+        if (wakeResult.has_error())
+        {
+            return cxx::error<SemaphoreError>(futexErrorToSemaphoreError(wakeResult.get_error()));
+        }
+    }
+    return cxx::success<>();
+}
+
+cxx::expected<SemaphoreError> BinarySemaphore::wait() noexcept
+{
+    auto result = waitUntilPosted(nullptr);
+    if (result.has_error())
+    {
+        return cxx::error<SemaphoreError>(result.get_error());
+    }
+    return cxx::success<>();
+}
+
+cxx::expected<SemaphoreWaitState, SemaphoreError>
+BinarySemaphore::timedWait(const units::Duration& timeToWait) noexcept
+{
+    const struct timespec absoluteTimeout = timeToWait.timespec(units::TimeSpecReference::Monotonic);
+    return waitUntilPosted(&absoluteTimeout);
+}
+
+cxx::expected<SemaphoreWaitState, SemaphoreError>
+BinarySemaphore::waitUntilPosted(const struct timespec* absoluteTimeout) noexcept
+{
+    auto value = m_futex.fetch_add(WAITER, std::memory_order_acq_rel) + WAITER;
+    while (true)
+    {
+        if ((value & POSTED) != 0U)
+        {
+            // consume the post and unregister in one step, a failed exchange reloads the value
+            if (m_futex.compare_exchange_weak(
+                    value, (value & ~POSTED) - WAITER, std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                return cxx::success<SemaphoreWaitState>(SemaphoreWaitState::NO_TIMEOUT);
+            }
+            continue;
+        }
+
+        auto waitResult = (absoluteTimeout == nullptr) ? futexWait(m_futex, value)
+                                                       : futexTimedWait(m_futex, value, *absoluteTimeout);
+        if (waitResult.has_error())
+        {
+            m_futex.fetch_sub(WAITER, std::memory_order_acq_rel);
+            return cxx::error<SemaphoreError>(futexErrorToSemaphoreError(waitResult.get_error()));
+        }
+        if (waitResult.value() == FutexWaitState::TIMEOUT)
+        {
+            m_futex.fetch_sub(WAITER, std::memory_order_acq_rel);
+            return cxx::success<SemaphoreWaitState>(SemaphoreWaitState::TIMEOUT);
+        }
+        value = m_futex.load(std::memory_order_acquire);
+    }
+}
+
+cxx::expected<SemaphoreError> BinarySemaphore::reset() noexcept
+{
+    m_futex.fetch_and(~POSTED, std::memory_order_acq_rel);
+    return cxx::success<>();
+}
+
+cxx::expected<bool, SemaphoreError> BinarySemaphore::isPosted() const noexcept
+{
+    return cxx::success<bool>((m_futex.load(std::memory_order_acquire) & POSTED) != 0U);
+}
+#else
+BinarySemaphore::BinarySemaphore() noexcept
+    : m_semaphore(std::move(Semaphore::create(CreateUnnamedSharedMemorySemaphore, 0U)
+                                .or_else([](SemaphoreError&) {
+                                    errorHandler(Error::kPOSIX_WRAPPER__FAILED_TO_CREATE_SEMAPHORE,
+                                                 nullptr,
+                                                 ErrorLevel::FATAL);
+                                })
+                                .value()))
+{
+}
+
+cxx::expected<SemaphoreError> BinarySemaphore::post() noexcept
+{
+    return m_semaphore.post();
+}
+
+cxx::expected<SemaphoreError> BinarySemaphore::wait() noexcept
+{
+    return m_semaphore.wait();
+}
+
+cxx::expected<SemaphoreWaitState, SemaphoreError>
+BinarySemaphore::timedWait(const units::Duration& timeToWait) noexcept
+{
+    return m_semaphore.timedWait(timeToWait);
+}
+
+cxx::expected<SemaphoreError> BinarySemaphore::reset() noexcept
+{
+    // count the semaphore down to zero
+    while (true)
+    {
+        auto result = m_semaphore.tryWait();
+        if (result.has_error())
+        {
+            return cxx::error<SemaphoreError>(result.get_error());
+        }
+        if (!result.value())
+        {
+            return cxx::success<>();
+        }
+    }
+}
+
+cxx::expected<bool, SemaphoreError> BinarySemaphore::isPosted() const noexcept
+{
+    auto result = m_semaphore.getValue();
+    if (result.has_error())
+    {
+        return cxx::error<SemaphoreError>(result.get_error());
+    }
+    return cxx::success<bool>(result.value() != 0);
+}
+#endif
+
+} // namespace posix
+} // namespace iox
@@ -0,0 +1,108 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/posix_wrapper/futex.hpp"
+
+#if defined(__linux__)
+#include <cerrno>
+#include <climits>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace iox
+{
+namespace posix
+{
+namespace
+{
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t),
+              "the futex syscall requires that std::atomic<uint32_t> has the layout of uint32_t");
+
+uint32_t* toFutexAddress(std::atomic<uint32_t>& futexWord) noexcept
+{
+    return reinterpret_cast<uint32_t*>(&futexWord);
+}
+
+FutexError errnoToEnum(const int errnum) noexcept
+{
+    switch (errnum)
+    {
+    case EFAULT:
+    case EINVAL:
+        return FutexError::INVALID_ARGUMENT;
+    default:
+        return FutexError::UNDEFINED;
+    }
+}
+
+/// @note the futex is not FUTEX_PRIVATE_FLAG since it is shared between processes
+cxx::expected<FutexWaitState, FutexError>
+wait(std::atomic<uint32_t>& futexWord, const uint32_t expectedValue, const struct timespec* timeout) noexcept
+{
+    // FUTEX_WAIT_BITSET takes an absolute CLOCK_MONOTONIC timeout in contrast to the relative one of FUTEX_WAIT
+    auto result = syscall(SYS_futex,
+                          toFutexAddress(futexWord),
+                          FUTEX_WAIT_BITSET,
+                          expectedValue,
+                          timeout,
+                          nullptr,
+                          FUTEX_BITSET_MATCH_ANY);
+    if (result == -1)
+    {
+        switch (errno)
+        {
+        case EAGAIN:
+        case EINTR:
+            return cxx::success<FutexWaitState>(FutexWaitState::WOKEN_UP);
+        case ETIMEDOUT:
+            return cxx::success<FutexWaitState>(FutexWaitState::TIMEOUT);
+        default:
+            return cxx::error<FutexError>(errnoToEnum(errno));
+        }
+    }
+    return cxx::success<FutexWaitState>(FutexWaitState::WOKEN_UP);
+}
+} // namespace
+
+cxx::expected<FutexWaitState, FutexError> futexWait(std::atomic<uint32_t>& futexWord,
+                                                    const uint32_t expectedValue) noexcept
+{
+    return wait(futexWord, expectedValue, nullptr);
+}
+
+cxx::expected<FutexWaitState, FutexError> futexTimedWait(std::atomic<uint32_t>& futexWord,
+                                                         const uint32_t expectedValue,
+                                                         const struct timespec& absoluteTimeout) noexcept
+{
+    return wait(futexWord, expectedValue, &absoluteTimeout);
+}
+
+cxx::expected<uint32_t, FutexError> futexWake(std::atomic<uint32_t>& futexWord,
+                                              const uint32_t numberOfWaiters) noexcept
+{
+    auto wakeCount = (numberOfWaiters > static_cast<uint32_t>(INT_MAX)) ? INT_MAX : static_cast<int>(numberOfWaiters);
+    auto result = syscall(SYS_futex, toFutexAddress(futexWord), FUTEX_WAKE, wakeCount, nullptr, nullptr, 0);
+    if (result == -1)
+    {
+        return cxx::error<FutexError>(errnoToEnum(errno));
+    }
+    return cxx::success<uint32_t>(static_cast<uint32_t>(result));
+}
+
+} // namespace posix
+} // namespace iox
+#endif
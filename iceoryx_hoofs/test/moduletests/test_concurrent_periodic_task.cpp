@@ -21,8 +21,10 @@
 
 #include "test.hpp"
 
+#include <atomic>
 #include <cstdint>
 #include <functional>
+#include <thread>
 
 namespace
 {
@@ -149,6 +151,38 @@ TEST_F(PeriodicTask_test, PeriodicTaskWhichIsInactiveDoesNotExecuteTheCallable)
     EXPECT_THAT(PeriodicTaskTestType::callCounter, Eq(0U));
 }
 
+TEST_F(PeriodicTask_test, PeriodicTaskDoesNotExecuteTheCallableInTheStartingThread)
+{
+    std::atomic<uint64_t> numberOfExecutionsInStartingThread{0U};
+    std::atomic<uint64_t> numberOfExecutions{0U};
+    const auto startingThread = std::this_thread::get_id();
+    {
+        concurrent::PeriodicTask<std::function<void()>> sut(PeriodicTaskAutoStart, INTERVAL, "Test", [&] {
+            if (std::this_thread::get_id() == startingThread)
+            {
+                ++numberOfExecutionsInStartingThread;
+            }
+            ++numberOfExecutions;
+        });
+
+        std::this_thread::sleep_for(SLEEP_TIME);
+    }
+
+    EXPECT_THAT(numberOfExecutionsInStartingThread.load(), Eq(0U));
+    EXPECT_THAT(numberOfExecutions.load(), Gt(0U));
+}
+
+TIMING_TEST_F(PeriodicTask_test, PeriodicTaskRunningOnDedicatedTimerWheel, Repeat(3), [&] {
+    concurrent::TimerWheel timerWheel;
+    {
+        concurrent::PeriodicTask<PeriodicTaskTestType> sut(PeriodicTaskAutoStart, timerWheel, INTERVAL, "Test");
+
+        std::this_thread::sleep_for(SLEEP_TIME);
+    }
+
+    EXPECT_THAT(PeriodicTaskTestType::callCounter, AllOf(Ge(MIN_RUNS), Le(MAX_RUNS)));
+});
+
 TIMING_TEST_F(PeriodicTask_test, PeriodicTaskRunningWithObjectWithDefaultConstructor, Repeat(3), [&] {
     {
         concurrent::PeriodicTask<PeriodicTaskTestType> sut(PeriodicTaskAutoStart, INTERVAL, "Test");
@@ -239,9 +273,16 @@ TIMING_TEST_F(PeriodicTask_test, PeriodicTaskWhichIsActiveAppliesNewIntervalAfte
 });
 
 TIMING_TEST_F(PeriodicTask_test, PeriodicTaskWhichIsExecutingTheCallableIsBlockingOnStop, Repeat(3), [&] {
+    std::atomic_bool isExecuting{false};
     auto start = std::chrono::steady_clock::now();
-    concurrent::PeriodicTask<cxx::function_ref<void()>> sut(
-        PeriodicTaskAutoStart, INTERVAL, "Test", [] { std::this_thread::sleep_for(SLEEP_TIME); });
+    concurrent::PeriodicTask<cxx::function_ref<void()>> sut(PeriodicTaskAutoStart, INTERVAL, "Test", [&] {
+        isExecuting = true;
+        std::this_thread::sleep_for(SLEEP_TIME);
+    });
+    while (!isExecuting)
+    {
+        std::this_thread::yield();
+    }
     sut.stop();
     auto stop = std::chrono::steady_clock::now();
     auto elapsedTime{std::chrono::duration_cast<std::chrono::milliseconds>(stop - start)};
@@ -0,0 +1,395 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/error_handling/error_handling.hpp"
+#include "iceoryx_hoofs/internal/concurrent/timer_wheel.hpp"
+#include "iceoryx_hoofs/testing/timing_test.hpp"
+
+#include "test.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::concurrent;
+using namespace iox::units::duration_literals;
+
+using CatchUpPolicy = TimerWheel::CatchUpPolicy;
+
+class TimerWheel_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        counter = 0;
+    }
+
+    void TearDown() override
+    {
+        // the wheel must not be destroyed with timers in use; timers which were already removed by the test are
+        // reported as invalid and ignored
+        for (auto& timerId : addedTimers)
+        {
+            IOX_DISCARD_RESULT(sut.remove(timerId));
+        }
+    }
+
+    cxx::expected<TimerWheel::TimerId, TimerWheelError> addTimer(const TimerWheel::Callback_t& callback)
+    {
+        auto timerId = sut.add(callback);
+        if (!timerId.has_error())
+        {
+            addedTimers.emplace_back(timerId.value());
+        }
+        return timerId;
+    }
+
+    static constexpr std::chrono::milliseconds SLEEP_TIME{100};
+    static constexpr units::Duration TIMEOUT{10_ms};
+
+    std::atomic<uint64_t> counter{0U};
+    TimerWheel sut;
+    std::vector<TimerWheel::TimerId> addedTimers;
+};
+
+constexpr std::chrono::milliseconds TimerWheel_test::SLEEP_TIME;
+constexpr units::Duration TimerWheel_test::TIMEOUT;
+
+TEST_F(TimerWheel_test, AddedTimerIsNotArmed)
+{
+    auto timerId = addTimer([&] { ++counter; });
+    ASSERT_FALSE(timerId.has_error());
+
+    auto isArmed = sut.isArmed(timerId.value());
+    ASSERT_FALSE(isArmed.has_error());
+    EXPECT_FALSE(isArmed.value());
+}
+
+TEST_F(TimerWheel_test, ArmedTimerIsArmed)
+{
+    auto timerId = addTimer([&] { ++counter; }).value();
+    ASSERT_FALSE(sut.arm(timerId, 1_s, 0_s, CatchUpPolicy::SKIP_TO_NEXT_BEAT).has_error());
+
+    EXPECT_TRUE(sut.isArmed(timerId).value());
+}
+
+TEST_F(TimerWheel_test, DisarmedTimerIsNotArmed)
+{
+    auto timerId = addTimer([&] { ++counter; }).value();
+    ASSERT_FALSE(sut.arm(timerId, 1_s, 0_s, CatchUpPolicy::SKIP_TO_NEXT_BEAT).has_error());
+    ASSERT_FALSE(sut.disarm(timerId).has_error());
+
+    EXPECT_FALSE(sut.isArmed(timerId).value());
+}
+
+TEST_F(TimerWheel_test, ArmWithZeroTimeoutFails)
+{
+    auto timerId = addTimer([&] { ++counter; }).value();
+
+    auto result = sut.arm(timerId, 0_s, 0_s, CatchUpPolicy::SKIP_TO_NEXT_BEAT);
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(TimerWheelError::TIMEOUT_IS_ZERO));
+}
+
+TEST_F(TimerWheel_test, RemovedTimerIdIsInvalid)
+{
+    auto timerId = addTimer([&] { ++counter; }).value();
+    ASSERT_FALSE(sut.remove(timerId).has_error());
+
+    auto result = sut.arm(timerId, 1_s, 0_s, CatchUpPolicy::SKIP_TO_NEXT_BEAT);
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(TimerWheelError::INVALID_TIMER_ID));
+    EXPECT_THAT(sut.remove(timerId).get_error(), Eq(TimerWheelError::INVALID_TIMER_ID));
+    EXPECT_THAT(sut.isArmed(timerId).get_error(), Eq(TimerWheelError::INVALID_TIMER_ID));
+}
+
+TEST_F(TimerWheel_test, TimerIdOfRemovedTimerDoesNotAffectReusedTimer)
+{
+    auto oldTimerId = addTimer([&] { ++counter; }).value();
+    ASSERT_FALSE(sut.remove(oldTimerId).has_error());
+    auto newTimerId = addTimer([&] { ++counter; }).value();
+    ASSERT_FALSE(sut.arm(newTimerId, 1_s, 0_s, CatchUpPolicy::SKIP_TO_NEXT_BEAT).has_error());
+
+    EXPECT_THAT(sut.disarm(oldTimerId).get_error(), Eq(TimerWheelError::INVALID_TIMER_ID));
+    EXPECT_TRUE(sut.isArmed(newTimerId).value());
+}
+
+TEST_F(TimerWheel_test, AddingMoreThanMaxNumberOfTimersFails)
+{
+    std::vector<TimerWheel::TimerId> timerIds;
+    for (uint32_t i = 0U; i < TimerWheel::MAX_NUMBER_OF_TIMERS; ++i)
+    {
+        auto timerId = addTimer([&] { ++counter; });
+        ASSERT_FALSE(timerId.has_error());
+        timerIds.emplace_back(timerId.value());
+    }
+
+    auto timerId = addTimer([&] { ++counter; });
+    ASSERT_TRUE(timerId.has_error());
+    EXPECT_THAT(timerId.get_error(), Eq(TimerWheelError::TIMER_LIMIT_REACHED));
+
+    ASSERT_FALSE(sut.remove(timerIds.front()).has_error());
+    EXPECT_FALSE(addTimer([&] { ++counter; }).has_error());
+}
+
+TEST_F(TimerWheel_test, DestroyingTimerWheelWithTimersInUseCallsErrorHandler)
+{
+    cxx::optional<Error> detectedError;
+    auto errorHandlerGuard = ErrorHandler::SetTemporaryErrorHandler(
+        [&](const Error error, const std::function<void()>, const ErrorLevel) { detectedError.emplace(error); });
+
+    {
+        TimerWheel otherSut;
+        ASSERT_FALSE(otherSut.add([&] { ++counter; }).has_error());
+    }
+
+    ASSERT_TRUE(detectedError.has_value());
+    EXPECT_THAT(detectedError.value(), Eq(Error::kTIMER_WHEEL__DESTROYED_WITH_TIMERS_IN_USE));
+}
+
+TEST_F(TimerWheel_test, DestroyingTimerWheelWithRemovedTimersDoesNotCallErrorHandler)
+{
+    cxx::optional<Error> detectedError;
+    auto errorHandlerGuard = ErrorHandler::SetTemporaryErrorHandler(
+        [&](const Error error, const std::function<void()>, const ErrorLevel) { detectedError.emplace(error); });
+
+    {
+        TimerWheel otherSut;
+        auto timerId = otherSut.add([&] { ++counter; }).value();
+        ASSERT_FALSE(otherSut.arm(timerId, TIMEOUT, TIMEOUT, CatchUpPolicy::SKIP_TO_NEXT_BEAT).has_error());
+        ASSERT_FALSE(otherSut.remove(timerId).has_error());
+    }
+
+    EXPECT_FALSE(detectedError.has_value());
+}
+
+TIMING_TEST_F(TimerWheel_test, OneShotTimerIsExecutedOnce, Repeat(5), [&] {
+    auto timerId = addTimer([&] { ++counter; }).value();
+    ASSERT_FALSE(sut.arm(timerId, TIMEOUT, 0_s, CatchUpPolicy::SKIP_TO_NEXT_BEAT).has_error());
+
+    std::this_thread::sleep_for(SLEEP_TIME);
+
+    TIMING_TEST_EXPECT_TRUE(counter == 1U);
+    TIMING_TEST_EXPECT_FALSE(sut.isArmed(timerId).value());
+});
+
+TIMING_TEST_F(TimerWheel_test, OneShotTimerIsNotExecutedPrematurely, Repeat(5), [&] {
+    auto timerId = addTimer([&] { ++counter; }).value();
+    ASSERT_FALSE(sut.arm(timerId, 5 * TIMEOUT, 0_s, CatchUpPolicy::SKIP_TO_NEXT_BEAT).has_error());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(4 * TIMEOUT.toMilliseconds()));
+
+    TIMING_TEST_EXPECT_TRUE(counter == 0U);
+});
+
+TIMING_TEST_F(TimerWheel_test, PeriodicTimerIsExecutedPeriodically, Repeat(5), [&] {
+    auto timerId = addTimer([&] { ++counter; }).value();
+    ASSERT_FALSE(sut.arm(timerId, TIMEOUT, TIMEOUT, CatchUpPolicy::SKIP_TO_NEXT_BEAT).has_error());
+
+    std::this_thread::sleep_for(SLEEP_TIME);
+    ASSERT_FALSE(sut.disarm(timerId).has_error());
+
+    TIMING_TEST_EXPECT_TRUE(7U <= counter && counter <= 11U);
+});
+
+TIMING_TEST_F(TimerWheel_test, DisarmedTimerIsNotExecuted, Repeat(5), [&] {
+    auto timerId = addTimer([&] { ++counter; }).value();
+    ASSERT_FALSE(sut.arm(timerId, TIMEOUT, TIMEOUT, CatchUpPolicy::SKIP_TO_NEXT_BEAT).has_error());
+    ASSERT_FALSE(sut.disarm(timerId).has_error());
+
+    std::this_thread::sleep_for(SLEEP_TIME);
+
+    TIMING_TEST_EXPECT_TRUE(counter == 0U);
+});
+
+TIMING_TEST_F(TimerWheel_test, TimerBeyondTheFirstLevelIsExecutedAfterCascading, Repeat(5), [&] {
+    // with a resolution of 100us the first level covers 25.6ms, the timer has to be cascaded from the second level
+    TimerWheel fineGrainedSut{100_us};
+    auto timerId = fineGrainedSut.add([&] { ++counter; }).value();
+    ASSERT_FALSE(fineGrainedSut.arm(timerId, 5 * TIMEOUT, 0_s, CatchUpPolicy::SKIP_TO_NEXT_BEAT).has_error());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(4 * TIMEOUT.toMilliseconds()));
+    TIMING_TEST_EXPECT_TRUE(counter == 0U);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(3 * TIMEOUT.toMilliseconds()));
+    TIMING_TEST_EXPECT_TRUE(counter == 1U);
+    ASSERT_FALSE(fineGrainedSut.remove(timerId).has_error());
+});
+
+TIMING_TEST_F(TimerWheel_test, MultipleTimersAreExecutedIndependently, Repeat(5), [&] {
+    std::atomic<uint64_t> otherCounter{0U};
+    auto timerId = addTimer([&] { ++counter; }).value();
+    auto otherTimerId = addTimer([&] { ++otherCounter; }).value();
+    ASSERT_FALSE(sut.arm(timerId, TIMEOUT, TIMEOUT, CatchUpPolicy::SKIP_TO_NEXT_BEAT).has_error());
+    ASSERT_FALSE(sut.arm(otherTimerId, 2 * TIMEOUT, 2 * TIMEOUT, CatchUpPolicy::SKIP_TO_NEXT_BEAT).has_error());
+
+    std::this_thread::sleep_for(SLEEP_TIME);
+    ASSERT_FALSE(sut.remove(timerId).has_error());
+    ASSERT_FALSE(sut.remove(otherTimerId).has_error());
+
+    TIMING_TEST_EXPECT_TRUE(7U <= counter && counter <= 11U);
+    TIMING_TEST_EXPECT_TRUE(3U <= otherCounter && otherCounter <= 6U);
+});
+
+TIMING_TEST_F(TimerWheel_test, TimeUntilExpirationDecreases, Repeat(5), [&] {
+    auto timerId = addTimer([&] { ++counter; }).value();
+    ASSERT_FALSE(sut.arm(timerId, 5 * TIMEOUT, 0_s, CatchUpPolicy::SKIP_TO_NEXT_BEAT).has_error());
+
+    auto timeUntilExpiration = sut.timeUntilExpiration(timerId).value().toMilliseconds();
+    TIMING_TEST_EXPECT_TRUE(4 * TIMEOUT.toMilliseconds() < timeUntilExpiration);
+    TIMING_TEST_EXPECT_TRUE(timeUntilExpiration <= 5 * TIMEOUT.toMilliseconds());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(3 * TIMEOUT.toMilliseconds()));
+
+    timeUntilExpiration = sut.timeUntilExpiration(timerId).value().toMilliseconds();
+    TIMING_TEST_EXPECT_TRUE(timeUntilExpiration <= 2 * TIMEOUT.toMilliseconds());
+});
+
+TEST_F(TimerWheel_test, TimeUntilExpirationIsZeroWhenNotArmed)
+{
+    auto timerId = addTimer([&] { ++counter; }).value();
+
+    EXPECT_THAT(sut.timeUntilExpiration(timerId).value().toNanoseconds(), Eq(0U));
+}
+
+TIMING_TEST_F(TimerWheel_test, RemoveBlocksUntilCallbackHasFinished, Repeat(5), [&] {
+    auto timerId = addTimer([&] {
+                          std::this_thread::sleep_for(SLEEP_TIME);
+                          ++counter;
+                      })
+                       .value();
+    ASSERT_FALSE(sut.arm(timerId, 1_ns, 0_s, CatchUpPolicy::SKIP_TO_NEXT_BEAT).has_error());
+    std::this_thread::sleep_for(std::chrono::milliseconds(TIMEOUT.toMilliseconds()));
+
+    ASSERT_FALSE(sut.remove(timerId).has_error());
+
+    TIMING_TEST_EXPECT_TRUE(counter == 1U);
+});
+
+TIMING_TEST_F(TimerWheel_test, DisarmDoesNotBlockWhileCallbackIsRunning, Repeat(5), [&] {
+    auto timerId = addTimer([&] {
+                          std::this_thread::sleep_for(SLEEP_TIME);
+                          ++counter;
+                      })
+                       .value();
+    ASSERT_FALSE(sut.arm(timerId, 1_ns, 0_s, CatchUpPolicy::SKIP_TO_NEXT_BEAT).has_error());
+    std::this_thread::sleep_for(std::chrono::milliseconds(TIMEOUT.toMilliseconds()));
+
+    ASSERT_FALSE(sut.disarm(timerId).has_error());
+
+    TIMING_TEST_EXPECT_TRUE(counter == 0U);
+    ASSERT_FALSE(sut.remove(timerId).has_error());
+});
+
+TIMING_TEST_F(TimerWheel_test, TimerCanRemoveItselfFromTheCallback, Repeat(5), [&] {
+    TimerWheel::TimerId timerId;
+    timerId = addTimer([&] {
+                     ++counter;
+                     EXPECT_FALSE(sut.remove(timerId).has_error());
+                 })
+                  .value();
+    ASSERT_FALSE(sut.arm(timerId, TIMEOUT, TIMEOUT, CatchUpPolicy::SKIP_TO_NEXT_BEAT).has_error());
+
+    std::this_thread::sleep_for(SLEEP_TIME);
+
+    TIMING_TEST_EXPECT_TRUE(counter == 1U);
+    TIMING_TEST_EXPECT_TRUE(sut.isArmed(timerId).has_error());
+});
+
+TIMING_TEST_F(TimerWheel_test, TimerCanRearmItselfFromTheCallback, Repeat(5), [&] {
+    TimerWheel::TimerId timerId;
+    timerId = addTimer([&] {
+                     ++counter;
+                     EXPECT_FALSE(sut.arm(timerId, 1_ns, 0_s, CatchUpPolicy::SKIP_TO_NEXT_BEAT).has_error());
+                 })
+                  .value();
+    ASSERT_FALSE(sut.arm(timerId, 1_ns, 0_s, CatchUpPolicy::SKIP_TO_NEXT_BEAT).has_error());
+
+    std::this_thread::sleep_for(SLEEP_TIME);
+    ASSERT_FALSE(sut.remove(timerId).has_error());
+
+    TIMING_TEST_EXPECT_TRUE(counter > 10U);
+});
+
+TIMING_TEST_F(TimerWheel_test, SkipToNextBeatDropsMissedExpirations, Repeat(5), [&] {
+    auto timerId = addTimer([&] {
+                          ++counter;
+                          std::this_thread::sleep_for(std::chrono::microseconds(TIMEOUT.toMilliseconds() * 1100));
+                      })
+                       .value();
+    ASSERT_FALSE(sut.arm(timerId, TIMEOUT, TIMEOUT, CatchUpPolicy::SKIP_TO_NEXT_BEAT).has_error());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(TIMEOUT.toMilliseconds() * 100));
+    ASSERT_FALSE(sut.remove(timerId).has_error());
+
+    TIMING_TEST_EXPECT_TRUE(40U <= counter && counter <= 60U);
+});
+
+TIMING_TEST_F(TimerWheel_test, ImmediateExecutesCallbackRightAfterTheMissedExpiration, Repeat(5), [&] {
+    auto timerId = addTimer([&] {
+                          ++counter;
+                          std::this_thread::sleep_for(std::chrono::microseconds(TIMEOUT.toMilliseconds() * 1100));
+                      })
+                       .value();
+    ASSERT_FALSE(sut.arm(timerId, TIMEOUT, TIMEOUT, CatchUpPolicy::IMMEDIATE).has_error());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(TIMEOUT.toMilliseconds() * 100));
+    ASSERT_FALSE(sut.remove(timerId).has_error());
+
+    TIMING_TEST_EXPECT_TRUE(70U < counter && counter <= 100U);
+});
+
+TIMING_TEST_F(TimerWheel_test, OverrunsAreCountedWhenCallbackExceedsThePeriod, Repeat(5), [&] {
+    auto timerId = addTimer([&] {
+                          ++counter;
+                          std::this_thread::sleep_for(std::chrono::milliseconds(TIMEOUT.toMilliseconds() * 3));
+                      })
+                       .value();
+    ASSERT_FALSE(sut.arm(timerId, TIMEOUT, TIMEOUT, CatchUpPolicy::SKIP_TO_NEXT_BEAT).has_error());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(TIMEOUT.toMilliseconds() * 5));
+
+    TIMING_TEST_EXPECT_TRUE(sut.getOverruns(timerId).value() >= 2U);
+    ASSERT_FALSE(sut.remove(timerId).has_error());
+});
+
+TIMING_TEST_F(TimerWheel_test, TerminateCallsErrorHandlerWhenCallbackExceedsThePeriod, Repeat(5), [&] {
+    std::atomic_bool hasTerminated{false};
+    auto errorHandlerGuard = ErrorHandler::SetTemporaryErrorHandler(
+        [&](const Error error, const std::function<void()>, const ErrorLevel) {
+            EXPECT_THAT(error, Eq(Error::kTIMER_WHEEL__CALLBACK_RUNTIME_EXCEEDS_PERIOD));
+            hasTerminated = true;
+        });
+
+    auto timerId = addTimer([&] {
+                          std::this_thread::sleep_for(std::chrono::milliseconds(TIMEOUT.toMilliseconds() * 2));
+                      })
+                       .value();
+    ASSERT_FALSE(sut.arm(timerId, TIMEOUT, TIMEOUT, CatchUpPolicy::TERMINATE).has_error());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(TIMEOUT.toMilliseconds() * 5));
+    ASSERT_FALSE(sut.remove(timerId).has_error());
+
+    TIMING_TEST_EXPECT_TRUE(hasTerminated);
+});
+} // namespace
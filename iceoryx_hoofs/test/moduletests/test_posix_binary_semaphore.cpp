@@ -0,0 +1,151 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/posix_wrapper/binary_semaphore.hpp"
+#include "iceoryx_hoofs/testing/test.hpp"
+#include "iceoryx_hoofs/testing/watch_dog.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::units::duration_literals;
+using namespace iox::posix;
+
+class BinarySemaphore_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        deadlockWatchdog.watchAndActOnFailure([] { std::terminate(); });
+    }
+
+    BinarySemaphore sut;
+    iox::units::Duration watchdogTimeout = 5_s;
+    Watchdog deadlockWatchdog{watchdogTimeout};
+};
+
+TEST_F(BinarySemaphore_test, IsNotPostedAfterConstruction)
+{
+    auto result = sut.isPosted();
+    ASSERT_FALSE(result.has_error());
+    EXPECT_FALSE(result.value());
+}
+
+TEST_F(BinarySemaphore_test, IsPostedAfterPost)
+{
+    ASSERT_FALSE(sut.post().has_error());
+    auto result = sut.isPosted();
+    ASSERT_FALSE(result.has_error());
+    EXPECT_TRUE(result.value());
+}
+
+TEST_F(BinarySemaphore_test, IsNotPostedAfterReset)
+{
+    ASSERT_FALSE(sut.post().has_error());
+    ASSERT_FALSE(sut.post().has_error());
+    ASSERT_FALSE(sut.reset().has_error());
+    auto result = sut.isPosted();
+    ASSERT_FALSE(result.has_error());
+    EXPECT_FALSE(result.value());
+}
+
+TEST_F(BinarySemaphore_test, WaitReturnsImmediatelyWhenPostedAndResetsTheSemaphore)
+{
+    ASSERT_FALSE(sut.post().has_error());
+    ASSERT_FALSE(sut.wait().has_error());
+    auto result = sut.isPosted();
+    ASSERT_FALSE(result.has_error());
+    EXPECT_FALSE(result.value());
+}
+
+TEST_F(BinarySemaphore_test, TimedWaitReturnsNoTimeoutWhenPosted)
+{
+    ASSERT_FALSE(sut.post().has_error());
+    auto result = sut.timedWait(1_ms);
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(result.value(), Eq(SemaphoreWaitState::NO_TIMEOUT));
+}
+
+TEST_F(BinarySemaphore_test, TimedWaitReturnsTimeoutWhenNotPosted)
+{
+    constexpr int64_t TIME_TO_WAIT_IN_MS{10};
+    auto start = std::chrono::steady_clock::now();
+    auto result = sut.timedWait(iox::units::Duration::fromMilliseconds(TIME_TO_WAIT_IN_MS));
+    auto end = std::chrono::steady_clock::now();
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(result.value(), Eq(SemaphoreWaitState::TIMEOUT));
+    EXPECT_THAT(std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count(),
+                Ge(TIME_TO_WAIT_IN_MS));
+}
+
+TEST_F(BinarySemaphore_test, WaitBlocksUntilPostFromOtherThread)
+{
+    std::atomic_bool hasWaited{false};
+    std::thread waiter([&] {
+        EXPECT_FALSE(sut.wait().has_error());
+        hasWaited = true;
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_FALSE(hasWaited.load());
+
+    ASSERT_FALSE(sut.post().has_error());
+    waiter.join();
+    EXPECT_TRUE(hasWaited.load());
+}
+
+TEST_F(BinarySemaphore_test, TimedWaitIsWokenUpByPostFromOtherThread)
+{
+    std::atomic<SemaphoreWaitState> waitState{SemaphoreWaitState::TIMEOUT};
+    std::thread waiter([&] {
+        auto result = sut.timedWait(4_s);
+        ASSERT_FALSE(result.has_error());
+        waitState = result.value();
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    ASSERT_FALSE(sut.post().has_error());
+    waiter.join();
+    EXPECT_THAT(waitState.load(), Eq(SemaphoreWaitState::NO_TIMEOUT));
+}
+
+TEST_F(BinarySemaphore_test, NoPostIsLostWhenPostAndWaitAlternateBetweenThreads)
+{
+    constexpr uint64_t NUMBER_OF_ROUND_TRIPS{10000U};
+    BinarySemaphore pong;
+
+    std::thread echo([&] {
+        for (uint64_t i = 0U; i < NUMBER_OF_ROUND_TRIPS; ++i)
+        {
+            ASSERT_FALSE(sut.wait().has_error());
+            ASSERT_FALSE(pong.post().has_error());
+        }
+    });
+
+    for (uint64_t i = 0U; i < NUMBER_OF_ROUND_TRIPS; ++i)
+    {
+        ASSERT_FALSE(sut.post().has_error());
+        ASSERT_FALSE(pong.wait().has_error());
+    }
+    echo.join();
+}
+
+} // namespace
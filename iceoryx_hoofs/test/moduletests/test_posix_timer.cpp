@@ -404,7 +404,8 @@ TIMING_TEST_F(Timer_test, CatchUpPolicyTerminateTerminatesWhenCallbackIsLongerTh
 
     ASSERT_FALSE(sut.start(Timer::RunMode::PERIODIC, Timer::CatchUpPolicy::TERMINATE).has_error());
 
-    std::this_thread::sleep_for(std::chrono::milliseconds(TIMEOUT.toMilliseconds() * 10));
+    // the exceeded period is detected when the callback returns, therefore wait until it has finished at least once
+    std::this_thread::sleep_for(std::chrono::milliseconds(TIMEOUT.toMilliseconds() * 20));
     TIMING_TEST_EXPECT_TRUE(hasTerminated);
 });
 
@@ -418,7 +419,9 @@ TIMING_TEST_F(Timer_test, CatchUpPolicyChangeToTerminateChangesBehaviorToTermina
     ASSERT_FALSE(sut.start(Timer::RunMode::PERIODIC, Timer::CatchUpPolicy::SKIP_TO_NEXT_BEAT).has_error());
     std::this_thread::sleep_for(std::chrono::milliseconds(TIMEOUT.toMilliseconds() * 10));
     ASSERT_FALSE(sut.restart(TIMEOUT, Timer::RunMode::PERIODIC, Timer::CatchUpPolicy::TERMINATE).has_error());
-    std::this_thread::sleep_for(std::chrono::milliseconds(TIMEOUT.toMilliseconds() * 10));
+    // the exceeded period is detected when the callback returns, therefore wait until it has finished at least once
+    // with the new policy
+    std::this_thread::sleep_for(std::chrono::milliseconds(TIMEOUT.toMilliseconds() * 20));
 
     TIMING_TEST_EXPECT_TRUE(hasTerminated);
 });
@@ -0,0 +1,237 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/concurrent/lockfree_queue.hpp"
+#include "iceoryx_hoofs/cxx/convert.hpp"
+#include "iceoryx_hoofs/internal/concurrent/fifo.hpp"
+#include "iceoryx_hoofs/internal/concurrent/loffli.hpp"
+#include "iceoryx_hoofs/internal/concurrent/sofi.hpp"
+#include "iceoryx_hoofs/platform/platform_settings.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+#if defined(__linux__)
+#include <pthread.h>
+#endif
+
+/// @brief The producer and the consumer of every scenario run on different cores and exchange the given number of
+///        messages. Every member which is written by one side and read by the other side causes a cache line
+///        transfer, members which are only located on the same cache line cause additional transfers (false
+///        sharing). Run the benchmark with 'perf c2c record' to get the HITM events and divide them by the number of
+///        messages, see README.md.
+
+constexpr uint64_t QUEUE_CAPACITY{256U};
+constexpr uint64_t DEFAULT_NUMBER_OF_MESSAGES{10000000U};
+/// @brief a side which does not make progress yields after this number of attempts, otherwise a benchmark on a single
+///        core would only measure the time slices of the scheduler
+constexpr uint64_t SPIN_LIMIT{1000U};
+
+/// @brief calls the action until it succeeds, yields after SPIN_LIMIT failed attempts
+template <typename Action>
+void spinThenYield(const Action& action, uint64_t& failedAttempts)
+{
+    if (action())
+    {
+        failedAttempts = 0U;
+    }
+    else if (++failedAttempts >= SPIN_LIMIT)
+    {
+        failedAttempts = 0U;
+        std::this_thread::yield();
+    }
+}
+
+void pinToCore(std::thread& thread, const uint32_t core)
+{
+#if defined(__linux__)
+    if (std::thread::hardware_concurrency() > core)
+    {
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        CPU_SET(core, &cpuSet);
+        pthread_setaffinity_np(thread.native_handle(), sizeof(cpu_set_t), &cpuSet);
+    }
+#else
+    static_cast<void>(thread);
+    static_cast<void>(core);
+#endif
+}
+
+/// @brief the producer is called until the consumer succeeded numberOfMessages times, both return true on success
+template <typename Producer, typename Consumer>
+void PerformBenchmark(const char* scenario,
+                      const uint64_t sizeOfSharedData,
+                      const uint64_t numberOfMessages,
+                      const Producer& produce,
+                      const Consumer& consume)
+{
+    std::atomic_bool keepRunning{true};
+    std::atomic_bool start{false};
+
+    std::thread producer([&] {
+        while (!start)
+        {
+        }
+        uint64_t failedAttempts{0U};
+        while (keepRunning)
+        {
+            spinThenYield(produce, failedAttempts);
+        }
+    });
+    std::thread consumer([&] {
+        while (!start)
+        {
+        }
+        uint64_t numberOfReceivedMessages{0U};
+        uint64_t failedAttempts{0U};
+        while (numberOfReceivedMessages < numberOfMessages)
+        {
+            spinThenYield(
+                [&] {
+                    if (consume())
+                    {
+                        ++numberOfReceivedMessages;
+                        return true;
+                    }
+                    return false;
+                },
+                failedAttempts);
+        }
+        keepRunning = false;
+    });
+    pinToCore(producer, 0U);
+    pinToCore(consumer, 1U);
+
+    auto begin = std::chrono::steady_clock::now();
+    start = true;
+    consumer.join();
+    auto end = std::chrono::steady_clock::now();
+    producer.join();
+
+    auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count();
+    std::cout << std::setw(12) << scenario << " [ " << std::setw(6) << sizeOfSharedData << " bytes ] "
+              << std::setw(10) << numberOfMessages << " messages : " << std::fixed << std::setprecision(2)
+              << static_cast<double>(nanoseconds) / static_cast<double>(numberOfMessages) << " ns/message"
+              << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+    uint64_t numberOfMessages{DEFAULT_NUMBER_OF_MESSAGES};
+    if (argc > 1 && !iox::cxx::convert::fromString(argv[1], numberOfMessages))
+    {
+        std::cerr << "usage: " << argv[0] << " [number of messages]" << std::endl;
+        return 1;
+    }
+
+    std::cout << "cache line size " << iox::platform::IOX_CACHE_LINE_SIZE << " bytes, "
+              << std::thread::hardware_concurrency() << " cores" << std::endl;
+
+    {
+        iox::concurrent::FiFo<uint64_t, QUEUE_CAPACITY> fifo;
+        uint64_t value{0U};
+        PerformBenchmark(
+            "FiFo",
+            sizeof(fifo),
+            numberOfMessages,
+            [&] {
+                if (fifo.push(value))
+                {
+                    ++value;
+                    return true;
+                }
+                return false;
+            },
+            [&] { return fifo.pop().has_value(); });
+    }
+
+    {
+        iox::concurrent::SoFi<uint64_t, QUEUE_CAPACITY> sofi;
+        uint64_t value{0U};
+        PerformBenchmark(
+            "SoFi",
+            sizeof(sofi),
+            numberOfMessages,
+            [&] {
+                // the SoFi never rejects a value, the producer yields when it overtook the consumer
+                uint64_t overflowValue{0U};
+                return sofi.push(value++, overflowValue);
+            },
+            [&] {
+                uint64_t poppedValue{0U};
+                return sofi.pop(poppedValue);
+            });
+    }
+
+    {
+        iox::concurrent::LockFreeQueue<uint64_t, QUEUE_CAPACITY> queue;
+        uint64_t value{0U};
+        PerformBenchmark(
+            "LockFreeQueue",
+            sizeof(queue),
+            numberOfMessages,
+            [&] {
+                if (queue.tryPush(value))
+                {
+                    ++value;
+                    return true;
+                }
+                return false;
+            },
+            [&] { return queue.pop().has_value(); });
+    }
+
+    {
+        // the round trip of a chunk index: acquired from the free list by the producer, transferred with a FiFo and
+        // released to the free list by the consumer
+        using Index_t = iox::concurrent::LoFFLi::Index_t;
+        Index_t freeIndicesMemory[iox::concurrent::LoFFLi::requiredIndexMemorySize(QUEUE_CAPACITY) / sizeof(Index_t)];
+        iox::concurrent::LoFFLi freeList;
+        freeList.init(freeIndicesMemory, QUEUE_CAPACITY);
+        iox::concurrent::FiFo<Index_t, QUEUE_CAPACITY> fifo;
+        PerformBenchmark(
+            "LoFFLi+FiFo",
+            sizeof(freeList) + sizeof(fifo),
+            numberOfMessages,
+            [&] {
+                Index_t index{0U};
+                if (!freeList.pop(index))
+                {
+                    return false;
+                }
+                if (!fifo.push(index))
+                {
+                    freeList.push(index);
+                    return false;
+                }
+                return true;
+            },
+            [&] {
+                auto index = fifo.pop();
+                if (index.has_value())
+                {
+                    freeList.push(index.value());
+                }
+                return index.has_value();
+            });
+    }
+
+    return 0;
+}
@@ -73,19 +73,21 @@ class MemPool
     void adjustMinFree() noexcept;
     bool isMultipleOfAlignment(const uint32_t value) const noexcept;
 
-    rp::RelativePointer<uint8_t> m_rawMemory;
-
-    uint32_t m_chunkSize{0U};
-    /// needs to be 32 bit since loffli supports only 32 bit numbers
-    /// (cas is only 64 bit and we need the other 32 bit for the aba counter)
-    uint32_t m_numberOfChunks{0U};
-
     /// @todo: put this into one struct and in a separate class in concurrent.
     std::atomic<uint32_t> m_usedChunks{0U};
     std::atomic<uint32_t> m_minFree{0U};
     /// @todo: end
 
+    /// @note the counters above and the head of the free list are written by every getChunk and freeChunk, the
+    ///       padding of the head keeps them apart from the members below which are only written by the constructor
     freeList_t m_freeIndices;
+
+    rp::RelativePointer<uint8_t> m_rawMemory;
+
+    uint32_t m_chunkSize{0U};
+    /// needs to be 32 bit since loffli supports only 32 bit numbers
+    /// (cas is only 64 bit and we need the other 32 bit for the aba counter)
+    uint32_t m_numberOfChunks{0U};
 };
 
 } // namespace mepoo
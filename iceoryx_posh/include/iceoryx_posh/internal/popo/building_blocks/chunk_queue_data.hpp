@@ -30,17 +30,30 @@ namespace iox
 {
 namespace popo
 {
-template <typename ChunkQueueDataProperties, typename LockingPolicy>
+/// @tparam QueueType the queue of chunks, either a cxx::VariantQueue with the maximum capacity which is embedded in
+///         the ChunkQueueData or a ChunkQueueStorage whose memory is provided by the creator of the ChunkQueueData
+template <typename ChunkQueueDataProperties,
+          typename LockingPolicy,
+          typename QueueType =
+              cxx::VariantQueue<mepoo::ShmSafeUnmanagedChunk, ChunkQueueDataProperties::MAX_QUEUE_CAPACITY>>
 struct ChunkQueueData : public LockingPolicy
 {
-    using ThisType_t = ChunkQueueData<ChunkQueueDataProperties, LockingPolicy>;
+    using ThisType_t = ChunkQueueData<ChunkQueueDataProperties, LockingPolicy, QueueType>;
     using LockGuard_t = std::lock_guard<const ThisType_t>;
     using ChunkQueueDataProperties_t = ChunkQueueDataProperties;
+    using Queue_t = QueueType;
 
-    ChunkQueueData(const QueueFullPolicy policy, const cxx::VariantQueueTypes queueType) noexcept;
+    /// @param[in] policy which is applied when the queue is full
+    /// @param[in] queueType of the underlying queue
+    /// @param[in] queueArgs additional arguments for the construction of the queue, e.g. the memory of a
+    ///            ChunkQueueStorage
+    template <typename... QueueArgs>
+    ChunkQueueData(const QueueFullPolicy policy,
+                   const cxx::VariantQueueTypes queueType,
+                   QueueArgs&&... queueArgs) noexcept;
 
     static constexpr uint64_t MAX_CAPACITY = ChunkQueueDataProperties_t::MAX_QUEUE_CAPACITY;
-    cxx::VariantQueue<mepoo::ShmSafeUnmanagedChunk, MAX_CAPACITY> m_queue;
+    Queue_t m_queue;
     std::atomic_bool m_queueHasLostChunks{false};
 
     rp::RelativePointer<ConditionVariableData> m_conditionVariableDataPtr;
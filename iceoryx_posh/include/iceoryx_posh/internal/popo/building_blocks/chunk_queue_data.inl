@@ -21,10 +21,11 @@ namespace iox
 {
 namespace popo
 {
-template <typename ChunkQueueProperties, typename LockingPolicy>
-inline ChunkQueueData<ChunkQueueProperties, LockingPolicy>::ChunkQueueData(
-    const QueueFullPolicy policy, const cxx::VariantQueueTypes queueType) noexcept
-    : m_queue(queueType)
+template <typename ChunkQueueProperties, typename LockingPolicy, typename QueueType>
+template <typename... QueueArgs>
+inline ChunkQueueData<ChunkQueueProperties, LockingPolicy, QueueType>::ChunkQueueData(
+    const QueueFullPolicy policy, const cxx::VariantQueueTypes queueType, QueueArgs&&... queueArgs) noexcept
+    : m_queue(queueType, std::forward<QueueArgs>(queueArgs)...)
     , m_queueFullPolicy(policy)
 {
 }
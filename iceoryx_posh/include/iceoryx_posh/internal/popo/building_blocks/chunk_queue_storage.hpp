@@ -0,0 +1,244 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_QUEUE_STORAGE_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_QUEUE_STORAGE_HPP
+
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/cxx/variant_queue.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
+#include "iceoryx_hoofs/internal/relocatable_pointer/relative_pointer.hpp"
+#include "iceoryx_hoofs/internal/relocatable_pointer/relocatable_pointer.hpp"
+#include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The queue of a ChunkQueueStorage is a cxx::VariantQueue with the capacity of one of
+///        NUMBER_OF_CHUNK_QUEUE_CAPACITY_CLASSES capacity classes. Class 0 has the maximum capacity of the queue and
+///        every following class a quarter of the capacity of its predecessor, but at least a capacity of one.
+constexpr uint64_t NUMBER_OF_CHUNK_QUEUE_CAPACITY_CLASSES{5U};
+
+/// @brief the memory of the queue of a ChunkQueueStorage
+struct ChunkQueueMemory
+{
+    void* m_memory{nullptr};
+    uint64_t m_capacityClass{0U};
+};
+
+namespace internal
+{
+constexpr uint64_t chunkQueueClassCapacity(const uint64_t maxCapacity, const uint64_t capacityClass) noexcept
+{
+    return ((maxCapacity >> (2U * capacityClass)) > 0U) ? (maxCapacity >> (2U * capacityClass)) : 1U;
+}
+} // namespace internal
+
+/// @brief The capacity classes of the queues with the maximum capacity MaxCapacity
+template <uint64_t MaxCapacity>
+struct ChunkQueueCapacityClasses
+{
+    static_assert(NUMBER_OF_CHUNK_QUEUE_CAPACITY_CLASSES == 5U, "dispatch() handles exactly five capacity classes");
+
+    /// @brief the queue type of a capacity class
+    template <uint64_t CapacityClass>
+    using Queue_t =
+        cxx::VariantQueue<mepoo::ShmSafeUnmanagedChunk, internal::chunkQueueClassCapacity(MaxCapacity, CapacityClass)>;
+
+    /// @brief returns the capacity of the queues of a capacity class
+    static constexpr uint64_t capacity(const uint64_t capacityClass) noexcept;
+
+    /// @brief returns the smallest capacity class which can hold the given capacity
+    static constexpr uint64_t classFor(const uint64_t capacity) noexcept;
+
+    /// @brief returns the alignment of the memory of all capacity classes
+    static constexpr uint64_t alignment() noexcept;
+
+    /// @brief returns the size of the memory of a queue of the capacity class, it is a multiple of alignment()
+    static constexpr uint64_t memorySize(const uint64_t capacityClass) noexcept;
+
+    /// @brief calls the function with a pointer to the queue in memory
+    /// @param[in] capacityClass of the queue in memory
+    /// @param[in] memory of the queue
+    /// @param[in] function which is called with a pointer to the queue type of the capacity class
+    template <typename Function>
+    static decltype(auto) dispatch(const uint64_t capacityClass, void* const memory, const Function& function) noexcept;
+};
+
+/// @brief The queue of a ChunkQueueData whose memory is not embedded in the ChunkQueueData. In contrast to a
+///        cxx::VariantQueue with the maximum capacity, the queue is constructed in separate memory which only needs to
+///        be as large as the capacity class of the queue. The capacity class is fixed at construction, every call is
+///        dispatched with a switch over the capacity class to the cxx::VariantQueue of this class.
+/// @note The memory is referenced by a relative pointer, therefore the ChunkQueueStorage can be shared between
+///       processes if the memory is located in a registered shared memory segment.
+template <uint64_t MaxCapacity>
+class ChunkQueueStorage
+{
+  public:
+    using CapacityClasses_t = ChunkQueueCapacityClasses<MaxCapacity>;
+
+    /// @brief memory which can hold the queue of every capacity class, for a ChunkQueueStorage whose memory is not
+    ///        provided by a ChunkQueueStoragePool
+    using MaxCapacityMemory_t =
+        std::aligned_storage_t<CapacityClasses_t::memorySize(0U), CapacityClasses_t::alignment()>;
+
+    /// @brief constructs the queue with the capacity of the capacity class of the memory
+    /// @param[in] queueType of the underlying cxx::VariantQueue
+    /// @param[in] memory in which the queue is constructed, it must have the size and alignment of its capacity class,
+    ///            must outlive the ChunkQueueStorage and must be located in the same shared memory segment as the
+    ///            ChunkQueueStorage
+    ChunkQueueStorage(const cxx::VariantQueueTypes queueType, const ChunkQueueMemory& memory) noexcept;
+
+    /// @brief destroys the queue, the memory is not released
+    ~ChunkQueueStorage() noexcept;
+
+    ChunkQueueStorage(const ChunkQueueStorage&) = delete;
+    ChunkQueueStorage(ChunkQueueStorage&&) = delete;
+    ChunkQueueStorage& operator=(const ChunkQueueStorage&) = delete;
+    ChunkQueueStorage& operator=(ChunkQueueStorage&&) = delete;
+
+    /// @copydoc cxx::VariantQueue::push
+    cxx::optional<mepoo::ShmSafeUnmanagedChunk> push(const mepoo::ShmSafeUnmanagedChunk& value) noexcept;
+
+    /// @copydoc cxx::VariantQueue::pop
+    cxx::optional<mepoo::ShmSafeUnmanagedChunk> pop() noexcept;
+
+    /// @copydoc cxx::VariantQueue::empty
+    bool empty() const noexcept;
+
+    /// @copydoc cxx::VariantQueue::size
+    uint64_t size() noexcept;
+
+    /// @brief set the capacity of the queue
+    /// @param[in] newCapacity valid values are 0 < newCapacity <= maxCapacity()
+    /// @return true if setting the new capacity succeeded, false otherwise
+    /// @note the restrictions of cxx::VariantQueue::setCapacity apply
+    bool setCapacity(const uint64_t newCapacity) noexcept;
+
+    /// @copydoc cxx::VariantQueue::capacity
+    uint64_t capacity() const noexcept;
+
+    /// @brief returns the capacity of the capacity class of the queue, which is the upper limit for setCapacity
+    uint64_t maxCapacity() const noexcept;
+
+    /// @brief returns the memory of the queue, e.g. to return it to a ChunkQueueStoragePool after the destruction of
+    ///        the ChunkQueueStorage
+    ChunkQueueMemory memory() const noexcept;
+
+  private:
+    template <typename Function>
+    decltype(auto) dispatch(const Function& function) const noexcept;
+
+  private:
+    /// @brief The memory is either located in the same shared memory segment as the ChunkQueueStorage or both are
+    ///        process local, therefore the offset between them is the same in every process. In contrast to a
+    ///        rp::RelativePointer, the pointer is resolved without a lookup of the segment.
+    rp::RelocatablePointer<uint8_t> m_memory;
+    uint64_t m_capacityClass{0U};
+};
+
+/// @brief Provides the memory for ChunkQueueStorages. It consists of two regions:
+///        - a reserved slot of the smallest capacity class for every queue, this guarantees that every queue gets
+///          memory independent of the capacity of the other queues
+///        - blocks with the size of the biggest capacity class which are shared by all queues. A free block is split
+///          into slots of the requested capacity class and returned to the free blocks when all its slots are
+///          released, therefore the memory of a capacity class can be reused by all other classes.
+///        The number of blocks is defined by the number of queue entries which are shared by the queues.
+/// @note the pool is not thread safe
+template <uint64_t MaxCapacity>
+class ChunkQueueStoragePool
+{
+  public:
+    using CapacityClasses_t = ChunkQueueCapacityClasses<MaxCapacity>;
+
+    /// @brief creates the pool with the memory acquired from the allocator
+    /// @param[in] numberOfQueues for which the pool reserves the memory of the smallest capacity class
+    /// @param[in] numberOfEntries the number of queue entries for which the pool provides shared memory in addition
+    /// @param[in] allocator to acquire the memory, it must be able to provide requiredMemorySize()
+    ChunkQueueStoragePool(const uint64_t numberOfQueues,
+                          const uint64_t numberOfEntries,
+                          posix::Allocator& allocator) noexcept;
+
+    ChunkQueueStoragePool(const ChunkQueueStoragePool&) = delete;
+    ChunkQueueStoragePool(ChunkQueueStoragePool&&) = delete;
+    ChunkQueueStoragePool& operator=(const ChunkQueueStoragePool&) = delete;
+    ChunkQueueStoragePool& operator=(ChunkQueueStoragePool&&) = delete;
+
+    /// @brief returns the memory which is acquired from the allocator for the given number of queues and entries
+    static uint64_t requiredMemorySize(const uint64_t numberOfQueues, const uint64_t numberOfEntries) noexcept;
+
+    /// @brief acquires the memory for a queue; preferably of the smallest capacity class which can hold the capacity.
+    ///        If there is no memory for this class left, the memory of the biggest available class is used. The
+    ///        caller has to check the capacity class of the returned memory.
+    /// @param[in] capacity of the queue
+    /// @return the memory for the queue or nullopt if all reserved slots and blocks are in use
+    cxx::optional<ChunkQueueMemory> allocate(const uint64_t capacity) noexcept;
+
+    /// @brief returns the memory of a queue to the pool
+    /// @param[in] memory which was acquired with allocate and whose queue is already destroyed
+    void deallocate(const ChunkQueueMemory& memory) noexcept;
+
+  private:
+    static constexpr uint64_t SMALLEST_CLASS{NUMBER_OF_CHUNK_QUEUE_CAPACITY_CLASSES - 1U};
+    static constexpr uint64_t INVALID_INDEX{std::numeric_limits<uint64_t>::max()};
+    static constexpr uint64_t BLOCK_SIZE{CapacityClasses_t::memorySize(0U)};
+    static constexpr uint64_t RESERVED_SLOT_SIZE{CapacityClasses_t::memorySize(SMALLEST_CLASS)};
+
+    /// @brief A block is either free, partially used by queues of its capacity class or fully used. Free and
+    ///        partially used blocks are linked in the list of free blocks or in the list of their capacity class.
+    struct Block
+    {
+        uint64_t m_capacityClass{INVALID_INDEX};
+        uint64_t m_numberOfUsedSlots{0U};
+        uint64_t m_freeSlot{INVALID_INDEX};
+        uint64_t m_next{INVALID_INDEX};
+        uint64_t m_previous{INVALID_INDEX};
+    };
+
+    static uint64_t numberOfBlocks(const uint64_t numberOfEntries) noexcept;
+    static uint64_t arenaSize(const uint64_t numberOfQueues, const uint64_t numberOfEntries) noexcept;
+
+    cxx::optional<ChunkQueueMemory> takeFromReservedSlots() noexcept;
+    cxx::optional<ChunkQueueMemory> takeFromBlocks(const uint64_t capacityClass) noexcept;
+    void splitFreeBlock(const uint64_t capacityClass) noexcept;
+    void linkBlock(uint64_t& head, const uint64_t blockIndex) noexcept;
+    void unlinkBlock(uint64_t& head, const uint64_t blockIndex) noexcept;
+    uint8_t* blockMemory(const uint64_t blockIndex) const noexcept;
+    uint8_t* reservedSlotMemory(const uint64_t slotIndex) const noexcept;
+
+    /// @brief the free slots are linked by the index of the next free slot in the memory of the slot
+    static uint64_t& nextFreeSlot(uint8_t* const slotMemory) noexcept;
+
+  private:
+    rp::RelativePointer<uint8_t> m_arena;
+    rp::RelativePointer<Block> m_blocks;
+    uint64_t m_numberOfBlocks{0U};
+    uint64_t m_numberOfReservedSlots{0U};
+    uint64_t m_freeReservedSlot{INVALID_INDEX};
+    uint64_t m_freeBlocks{INVALID_INDEX};
+    uint64_t m_partiallyUsedBlocks[NUMBER_OF_CHUNK_QUEUE_CAPACITY_CLASSES];
+};
+
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_storage.inl"
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_QUEUE_STORAGE_HPP
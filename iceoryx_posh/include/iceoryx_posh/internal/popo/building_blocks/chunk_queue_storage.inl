@@ -0,0 +1,446 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_QUEUE_STORAGE_INL
+#define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_QUEUE_STORAGE_INL
+
+#include "iceoryx_hoofs/cxx/helplets.hpp"
+
+#include <algorithm>
+#include <new>
+
+namespace iox
+{
+namespace popo
+{
+template <uint64_t MaxCapacity>
+inline constexpr uint64_t ChunkQueueCapacityClasses<MaxCapacity>::capacity(const uint64_t capacityClass) noexcept
+{
+    return internal::chunkQueueClassCapacity(MaxCapacity, capacityClass);
+}
+
+template <uint64_t MaxCapacity>
+inline constexpr uint64_t ChunkQueueCapacityClasses<MaxCapacity>::classFor(const uint64_t capacity) noexcept
+{
+    uint64_t capacityClass = NUMBER_OF_CHUNK_QUEUE_CAPACITY_CLASSES - 1U;
+    while (capacityClass > 0U && ChunkQueueCapacityClasses::capacity(capacityClass) < capacity)
+    {
+        --capacityClass;
+    }
+    return capacityClass;
+}
+
+template <uint64_t MaxCapacity>
+inline constexpr uint64_t ChunkQueueCapacityClasses<MaxCapacity>::alignment() noexcept
+{
+    return std::max({static_cast<uint64_t>(alignof(Queue_t<0U>)),
+                     static_cast<uint64_t>(alignof(Queue_t<1U>)),
+                     static_cast<uint64_t>(alignof(Queue_t<2U>)),
+                     static_cast<uint64_t>(alignof(Queue_t<3U>)),
+                     static_cast<uint64_t>(alignof(Queue_t<4U>))});
+}
+
+template <uint64_t MaxCapacity>
+inline constexpr uint64_t ChunkQueueCapacityClasses<MaxCapacity>::memorySize(const uint64_t capacityClass) noexcept
+{
+    uint64_t queueSize = sizeof(Queue_t<4U>);
+    switch (capacityClass)
+    {
+    case 0U:
+        queueSize = sizeof(Queue_t<0U>);
+        break;
+    case 1U:
+        queueSize = sizeof(Queue_t<1U>);
+        break;
+    case 2U:
+        queueSize = sizeof(Queue_t<2U>);
+        break;
+    case 3U:
+        queueSize = sizeof(Queue_t<3U>);
+        break;
+    default:
+        break;
+    }
+    return ((queueSize + alignment() - 1U) / alignment()) * alignment();
+}
+
+template <uint64_t MaxCapacity>
+template <typename Function>
+inline decltype(auto) ChunkQueueCapacityClasses<MaxCapacity>::dispatch(const uint64_t capacityClass,
+                                                                         void* const memory,
+                                                                         const Function& function) noexcept
+{
+    // a switch instead of a per-process function pointer table, in contrast to the indirect calls of the table the
+    // queue operations can be inlined; see stresstests/benchmark_chunk_queue_storage
+    switch (capacityClass)
+    {
+    case 0U:
+        return function(static_cast<Queue_t<0U>*>(memory));
+    case 1U:
+        return function(static_cast<Queue_t<1U>*>(memory));
+    case 2U:
+        return function(static_cast<Queue_t<2U>*>(memory));
+    case 3U:
+        return function(static_cast<Queue_t<3U>*>(memory));
+    default:
+        return function(static_cast<Queue_t<4U>*>(memory));
+    }
+}
+
+template <uint64_t MaxCapacity>
+inline ChunkQueueStorage<MaxCapacity>::ChunkQueueStorage(const cxx::VariantQueueTypes queueType,
+                                                         const ChunkQueueMemory& memory) noexcept
+    : m_memory(static_cast<uint8_t*>(memory.m_memory))
+    , m_capacityClass(memory.m_capacityClass)
+{
+    cxx::Expects(memory.m_memory != nullptr && memory.m_capacityClass < NUMBER_OF_CHUNK_QUEUE_CAPACITY_CLASSES);
+
+    dispatch([&](auto* queue) {
+        using Queue_t = std::remove_pointer_t<decltype(queue)>;
+        new (queue) Queue_t(queueType);
+    });
+}
+
+template <uint64_t MaxCapacity>
+inline ChunkQueueStorage<MaxCapacity>::~ChunkQueueStorage() noexcept
+{
+    dispatch([](auto* queue) {
+        using Queue_t = std::remove_pointer_t<decltype(queue)>;
+        queue->~Queue_t();
+    });
+}
+
+template <uint64_t MaxCapacity>
+template <typename Function>
+inline decltype(auto) ChunkQueueStorage<MaxCapacity>::dispatch(const Function& function) const noexcept
+{
+    return CapacityClasses_t::dispatch(m_capacityClass, static_cast<uint8_t*>(m_memory), function);
+}
+
+template <uint64_t MaxCapacity>
+inline cxx::optional<mepoo::ShmSafeUnmanagedChunk>
+ChunkQueueStorage<MaxCapacity>::push(const mepoo::ShmSafeUnmanagedChunk& value) noexcept
+{
+    return dispatch([&](auto* queue) { return queue->push(value); });
+}
+
+template <uint64_t MaxCapacity>
+inline cxx::optional<mepoo::ShmSafeUnmanagedChunk> ChunkQueueStorage<MaxCapacity>::pop() noexcept
+{
+    return dispatch([](auto* queue) { return queue->pop(); });
+}
+
+template <uint64_t MaxCapacity>
+inline bool ChunkQueueStorage<MaxCapacity>::empty() const noexcept
+{
+    return dispatch([](auto* queue) { return queue->empty(); });
+}
+
+template <uint64_t MaxCapacity>
+inline uint64_t ChunkQueueStorage<MaxCapacity>::size() noexcept
+{
+    return dispatch([](auto* queue) { return queue->size(); });
+}
+
+template <uint64_t MaxCapacity>
+inline bool ChunkQueueStorage<MaxCapacity>::setCapacity(const uint64_t newCapacity) noexcept
+{
+    if (newCapacity > maxCapacity())
+    {
+        return false;
+    }
+    return dispatch([&](auto* queue) { return queue->setCapacity(newCapacity); });
+}
+
+template <uint64_t MaxCapacity>
+inline uint64_t ChunkQueueStorage<MaxCapacity>::capacity() const noexcept
+{
+    return dispatch([](auto* queue) { return queue->capacity(); });
+}
+
+template <uint64_t MaxCapacity>
+inline uint64_t ChunkQueueStorage<MaxCapacity>::maxCapacity() const noexcept
+{
+    return CapacityClasses_t::capacity(m_capacityClass);
+}
+
+template <uint64_t MaxCapacity>
+inline ChunkQueueMemory ChunkQueueStorage<MaxCapacity>::memory() const noexcept
+{
+    return ChunkQueueMemory{static_cast<uint8_t*>(m_memory), m_capacityClass};
+}
+
+template <uint64_t MaxCapacity>
+constexpr uint64_t ChunkQueueStoragePool<MaxCapacity>::SMALLEST_CLASS;
+template <uint64_t MaxCapacity>
+constexpr uint64_t ChunkQueueStoragePool<MaxCapacity>::INVALID_INDEX;
+template <uint64_t MaxCapacity>
+constexpr uint64_t ChunkQueueStoragePool<MaxCapacity>::BLOCK_SIZE;
+template <uint64_t MaxCapacity>
+constexpr uint64_t ChunkQueueStoragePool<MaxCapacity>::RESERVED_SLOT_SIZE;
+
+template <uint64_t MaxCapacity>
+inline ChunkQueueStoragePool<MaxCapacity>::ChunkQueueStoragePool(const uint64_t numberOfQueues,
+                                                                 const uint64_t numberOfEntries,
+                                                                 posix::Allocator& allocator) noexcept
+    : m_numberOfBlocks(numberOfBlocks(numberOfEntries))
+    , m_numberOfReservedSlots(numberOfQueues)
+{
+    std::fill(std::begin(m_partiallyUsedBlocks), std::end(m_partiallyUsedBlocks), INVALID_INDEX);
+
+    const uint64_t size = arenaSize(numberOfQueues, numberOfEntries);
+    if (size > 0U)
+    {
+        m_arena = static_cast<uint8_t*>(allocator.allocate(size, CapacityClasses_t::alignment()));
+    }
+
+    if (m_numberOfBlocks > 0U)
+    {
+        m_blocks = static_cast<Block*>(allocator.allocate(m_numberOfBlocks * sizeof(Block), alignof(Block)));
+        Block* blocks = m_blocks.get();
+        for (uint64_t blockIndex = m_numberOfBlocks; blockIndex > 0U; --blockIndex)
+        {
+            new (&blocks[blockIndex - 1U]) Block();
+            linkBlock(m_freeBlocks, blockIndex - 1U);
+        }
+    }
+
+    for (uint64_t slotIndex = m_numberOfReservedSlots; slotIndex > 0U; --slotIndex)
+    {
+        nextFreeSlot(reservedSlotMemory(slotIndex - 1U)) = m_freeReservedSlot;
+        m_freeReservedSlot = slotIndex - 1U;
+    }
+}
+
+template <uint64_t MaxCapacity>
+inline uint64_t ChunkQueueStoragePool<MaxCapacity>::numberOfBlocks(const uint64_t numberOfEntries) noexcept
+{
+    // a block can hold a queue of the biggest capacity class or the same number of entries in smaller queues
+    return numberOfEntries / MaxCapacity + ((numberOfEntries % MaxCapacity != 0U) ? 1U : 0U);
+}
+
+template <uint64_t MaxCapacity>
+inline uint64_t ChunkQueueStoragePool<MaxCapacity>::arenaSize(const uint64_t numberOfQueues,
+                                                              const uint64_t numberOfEntries) noexcept
+{
+    return numberOfBlocks(numberOfEntries) * BLOCK_SIZE + numberOfQueues * RESERVED_SLOT_SIZE;
+}
+
+template <uint64_t MaxCapacity>
+inline uint64_t ChunkQueueStoragePool<MaxCapacity>::requiredMemorySize(const uint64_t numberOfQueues,
+                                                                       const uint64_t numberOfEntries) noexcept
+{
+    // the allocator might need to pad the memory in order to align it
+    uint64_t memorySize = arenaSize(numberOfQueues, numberOfEntries) + CapacityClasses_t::alignment();
+    const uint64_t blocks = numberOfBlocks(numberOfEntries);
+    if (blocks > 0U)
+    {
+        memorySize += blocks * sizeof(Block) + alignof(Block);
+    }
+    return memorySize;
+}
+
+template <uint64_t MaxCapacity>
+inline cxx::optional<ChunkQueueMemory> ChunkQueueStoragePool<MaxCapacity>::allocate(const uint64_t capacity) noexcept
+{
+    const uint64_t requestedClass = CapacityClasses_t::classFor(capacity);
+
+    // a queue of the smallest class does not need to share the blocks with the bigger queues
+    cxx::optional<ChunkQueueMemory> memory;
+    if (requestedClass == SMALLEST_CLASS)
+    {
+        memory = takeFromReservedSlots();
+    }
+
+    if (!memory.has_value())
+    {
+        memory = takeFromBlocks(requestedClass);
+    }
+
+    // the requested class could neither be taken from a partially used nor from a free block, therefore only the
+    // free slots of the partially used blocks of the other classes are left; the biggest one which is available is
+    // used and if there is none the reserved slot of the queue
+    for (uint64_t capacityClass = 0U; !memory.has_value() && capacityClass < NUMBER_OF_CHUNK_QUEUE_CAPACITY_CLASSES;
+         ++capacityClass)
+    {
+        memory = takeFromBlocks(capacityClass);
+    }
+
+    if (!memory.has_value())
+    {
+        memory = takeFromReservedSlots();
+    }
+
+    return memory;
+}
+
+template <uint64_t MaxCapacity>
+inline void ChunkQueueStoragePool<MaxCapacity>::deallocate(const ChunkQueueMemory& memory) noexcept
+{
+    cxx::Expects(memory.m_memory != nullptr && memory.m_capacityClass < NUMBER_OF_CHUNK_QUEUE_CAPACITY_CLASSES);
+
+    uint8_t* const slotMemory = static_cast<uint8_t*>(memory.m_memory);
+    uint8_t* const reservedSlots = reservedSlotMemory(0U);
+    if (slotMemory >= reservedSlots)
+    {
+        const uint64_t slotIndex = static_cast<uint64_t>(slotMemory - reservedSlots) / RESERVED_SLOT_SIZE;
+        cxx::Expects(slotIndex < m_numberOfReservedSlots && memory.m_capacityClass == SMALLEST_CLASS);
+
+        nextFreeSlot(slotMemory) = m_freeReservedSlot;
+        m_freeReservedSlot = slotIndex;
+        return;
+    }
+
+    const uint64_t blockIndex = static_cast<uint64_t>(slotMemory - m_arena.get()) / BLOCK_SIZE;
+    Block& block = m_blocks.get()[blockIndex];
+    cxx::Expects(block.m_capacityClass == memory.m_capacityClass && block.m_numberOfUsedSlots > 0U);
+
+    if (block.m_freeSlot == INVALID_INDEX)
+    {
+        linkBlock(m_partiallyUsedBlocks[block.m_capacityClass], blockIndex);
+    }
+    nextFreeSlot(slotMemory) = block.m_freeSlot;
+    block.m_freeSlot = static_cast<uint64_t>(slotMemory - blockMemory(blockIndex))
+                       / CapacityClasses_t::memorySize(block.m_capacityClass);
+    --block.m_numberOfUsedSlots;
+
+    if (block.m_numberOfUsedSlots == 0U)
+    {
+        unlinkBlock(m_partiallyUsedBlocks[block.m_capacityClass], blockIndex);
+        block.m_capacityClass = INVALID_INDEX;
+        block.m_freeSlot = INVALID_INDEX;
+        linkBlock(m_freeBlocks, blockIndex);
+    }
+}
+
+template <uint64_t MaxCapacity>
+inline cxx::optional<ChunkQueueMemory> ChunkQueueStoragePool<MaxCapacity>::takeFromReservedSlots() noexcept
+{
+    if (m_freeReservedSlot == INVALID_INDEX)
+    {
+        return cxx::nullopt;
+    }
+
+    uint8_t* const slotMemory = reservedSlotMemory(m_freeReservedSlot);
+    m_freeReservedSlot = nextFreeSlot(slotMemory);
+    return ChunkQueueMemory{slotMemory, SMALLEST_CLASS};
+}
+
+template <uint64_t MaxCapacity>
+inline cxx::optional<ChunkQueueMemory>
+ChunkQueueStoragePool<MaxCapacity>::takeFromBlocks(const uint64_t capacityClass) noexcept
+{
+    if (m_partiallyUsedBlocks[capacityClass] == INVALID_INDEX)
+    {
+        if (m_freeBlocks == INVALID_INDEX)
+        {
+            return cxx::nullopt;
+        }
+        splitFreeBlock(capacityClass);
+    }
+
+    const uint64_t blockIndex = m_partiallyUsedBlocks[capacityClass];
+    Block& block = m_blocks.get()[blockIndex];
+    uint8_t* const slotMemory =
+        blockMemory(blockIndex) + block.m_freeSlot * CapacityClasses_t::memorySize(capacityClass);
+    block.m_freeSlot = nextFreeSlot(slotMemory);
+    ++block.m_numberOfUsedSlots;
+
+    if (block.m_freeSlot == INVALID_INDEX)
+    {
+        unlinkBlock(m_partiallyUsedBlocks[capacityClass], blockIndex);
+    }
+
+    return ChunkQueueMemory{slotMemory, capacityClass};
+}
+
+template <uint64_t MaxCapacity>
+inline void ChunkQueueStoragePool<MaxCapacity>::splitFreeBlock(const uint64_t capacityClass) noexcept
+{
+    const uint64_t blockIndex = m_freeBlocks;
+    unlinkBlock(m_freeBlocks, blockIndex);
+
+    const uint64_t slotSize = CapacityClasses_t::memorySize(capacityClass);
+    const uint64_t numberOfSlots = BLOCK_SIZE / slotSize;
+    uint8_t* const memory = blockMemory(blockIndex);
+    for (uint64_t slotIndex = 0U; slotIndex < numberOfSlots; ++slotIndex)
+    {
+        nextFreeSlot(memory + slotIndex * slotSize) = (slotIndex + 1U < numberOfSlots) ? slotIndex + 1U : INVALID_INDEX;
+    }
+
+    Block& block = m_blocks.get()[blockIndex];
+    block.m_capacityClass = capacityClass;
+    block.m_numberOfUsedSlots = 0U;
+    block.m_freeSlot = 0U;
+    linkBlock(m_partiallyUsedBlocks[capacityClass], blockIndex);
+}
+
+template <uint64_t MaxCapacity>
+inline void ChunkQueueStoragePool<MaxCapacity>::linkBlock(uint64_t& head, const uint64_t blockIndex) noexcept
+{
+    Block* const blocks = m_blocks.get();
+    blocks[blockIndex].m_previous = INVALID_INDEX;
+    blocks[blockIndex].m_next = head;
+    if (head != INVALID_INDEX)
+    {
+        blocks[head].m_previous = blockIndex;
+    }
+    head = blockIndex;
+}
+
+template <uint64_t MaxCapacity>
+inline void ChunkQueueStoragePool<MaxCapacity>::unlinkBlock(uint64_t& head, const uint64_t blockIndex) noexcept
+{
+    Block* const blocks = m_blocks.get();
+    Block& block = blocks[blockIndex];
+    if (block.m_previous != INVALID_INDEX)
+    {
+        blocks[block.m_previous].m_next = block.m_next;
+    }
+    else
+    {
+        head = block.m_next;
+    }
+
+    if (block.m_next != INVALID_INDEX)
+    {
+        blocks[block.m_next].m_previous = block.m_previous;
+    }
+    block.m_next = INVALID_INDEX;
+    block.m_previous = INVALID_INDEX;
+}
+
+template <uint64_t MaxCapacity>
+inline uint8_t* ChunkQueueStoragePool<MaxCapacity>::blockMemory(const uint64_t blockIndex) const noexcept
+{
+    return m_arena.get() + blockIndex * BLOCK_SIZE;
+}
+
+template <uint64_t MaxCapacity>
+inline uint8_t* ChunkQueueStoragePool<MaxCapacity>::reservedSlotMemory(const uint64_t slotIndex) const noexcept
+{
+    return m_arena.get() + m_numberOfBlocks * BLOCK_SIZE + slotIndex * RESERVED_SLOT_SIZE;
+}
+
+template <uint64_t MaxCapacity>
+inline uint64_t& ChunkQueueStoragePool<MaxCapacity>::nextFreeSlot(uint8_t* const slotMemory) noexcept
+{
+    return *reinterpret_cast<uint64_t*>(slotMemory);
+}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_QUEUE_STORAGE_INL
@@ -31,9 +31,12 @@ namespace popo
 template <uint32_t MaxChunksHeldSimultaneously, typename ChunkQueueDataType>
 struct ChunkReceiverData : public ChunkQueueDataType
 {
+    /// @param[in] queueArgs additional arguments for the construction of the queue, see ChunkQueueData
+    template <typename... QueueArgs>
     explicit ChunkReceiverData(const cxx::VariantQueueTypes queueType,
                                const QueueFullPolicy queueFullPolicy,
-                               const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo()) noexcept;
+                               const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo(),
+                               QueueArgs&&... queueArgs) noexcept;
 
     using ChunkQueueData_t = ChunkQueueDataType;
 
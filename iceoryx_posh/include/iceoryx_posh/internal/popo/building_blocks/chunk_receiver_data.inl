@@ -22,11 +22,13 @@ namespace iox
 namespace popo
 {
 template <uint32_t MaxChunksHeldSimultaneously, typename ChunkQueueDataType>
+template <typename... QueueArgs>
 inline ChunkReceiverData<MaxChunksHeldSimultaneously, ChunkQueueDataType>::ChunkReceiverData(
     const cxx::VariantQueueTypes queueType,
     const QueueFullPolicy queueFullPolicy,
-    const mepoo::MemoryInfo& memoryInfo) noexcept
-    : ChunkQueueDataType(queueFullPolicy, queueType)
+    const mepoo::MemoryInfo& memoryInfo,
+    QueueArgs&&... queueArgs) noexcept
+    : ChunkQueueDataType(queueFullPolicy, queueType, std::forward<QueueArgs>(queueArgs)...)
     , m_memoryInfo(memoryInfo)
 {
 }
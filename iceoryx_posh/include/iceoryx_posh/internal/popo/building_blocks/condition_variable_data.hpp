@@ -18,7 +18,7 @@
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CONDITION_VARIABLE_DATA_HPP
 
 #include "iceoryx_hoofs/error_handling/error_handling.hpp"
-#include "iceoryx_hoofs/posix_wrapper/semaphore.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/binary_semaphore.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 
 #include <atomic>
@@ -38,14 +38,8 @@ struct ConditionVariableData
     ConditionVariableData& operator=(ConditionVariableData&& rhs) = delete;
     ~ConditionVariableData() = default;
 
-    posix::Semaphore m_semaphore =
-        std::move(posix::Semaphore::create(posix::CreateUnnamedSharedMemorySemaphore, 0u)
-                      .or_else([](posix::SemaphoreError&) {
-                          errorHandler(Error::kPOPO__CONDITION_VARIABLE_DATA_FAILED_TO_CREATE_SEMAPHORE,
-                                       nullptr,
-                                       ErrorLevel::FATAL);
-                      })
-                      .value());
+    /// @brief a futex word on Linux, notify() does not enter the kernel when the listener is not waiting
+    posix::BinarySemaphore m_semaphore;
 
     RuntimeName_t m_runtimeName;
     std::atomic_bool m_toBeDestroyed{false};
@@ -21,6 +21,7 @@
 #include "iceoryx_hoofs/cxx/variant_queue.hpp"
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_storage.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_receiver_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
 #include "iceoryx_posh/internal/popo/ports/base_port_data.hpp"
@@ -35,13 +36,17 @@ struct SubscriberOptions;
 
 struct SubscriberPortData : public BasePortData
 {
+    /// @param[in] queueMemory in which the queue of the subscriber is constructed, usually provided by the
+    ///            ChunkQueueStoragePool of the PortPool; its capacity class limits the queue capacity
     SubscriberPortData(const capro::ServiceDescription& serviceDescription,
                        const RuntimeName_t& runtimeName,
                        cxx::VariantQueueTypes queueType,
                        const SubscriberOptions& subscriberOptions,
+                       const ChunkQueueMemory& queueMemory,
                        const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo()) noexcept;
 
-    using ChunkQueueData_t = ChunkQueueData<DefaultChunkQueueConfig, ThreadSafePolicy>;
+    using ChunkQueue_t = ChunkQueueStorage<DefaultChunkQueueConfig::MAX_QUEUE_CAPACITY>;
+    using ChunkQueueData_t = ChunkQueueData<DefaultChunkQueueConfig, ThreadSafePolicy, ChunkQueue_t>;
     using ChunkReceiverData_t = ChunkReceiverData<MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY, ChunkQueueData_t>;
 
     ChunkReceiverData_t m_chunkReceiverData;
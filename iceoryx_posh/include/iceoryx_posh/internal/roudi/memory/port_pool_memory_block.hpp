@@ -20,6 +20,7 @@
 #include "iceoryx_posh/internal/roudi/port_pool_data.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iceoryx_posh/roudi/memory/memory_block.hpp"
+#include "iceoryx_posh/roudi/roudi_config.hpp"
 
 #include <cstdint>
 
@@ -30,9 +31,9 @@ namespace roudi
 class PortPoolMemoryBlock : public MemoryBlock
 {
   public:
-    /// @todo the PortPool needs to be refactored to use a typed MemPool
-    /// once that is done, the cTor needs a configuration similar to MemPoolCollectionMemoryProvider
-    PortPoolMemoryBlock() noexcept = default;
+    /// @brief Creates a MemoryBlock for the PortPool
+    /// @param [in] portPoolConfig with the capacities of the PortPool which determine the size of the MemoryBlock
+    explicit PortPoolMemoryBlock(const config::PortPoolConfig& portPoolConfig = config::PortPoolConfig()) noexcept;
     ~PortPoolMemoryBlock() noexcept;
 
     PortPoolMemoryBlock(const PortPoolMemoryBlock&) = delete;
@@ -62,6 +63,7 @@ class PortPoolMemoryBlock : public MemoryBlock
     cxx::optional<PortPoolData*> portPool() const noexcept;
 
   private:
+    config::PortPoolConfig m_portPoolConfig;
     PortPoolData* m_portPoolData{nullptr};
 };
 
@@ -19,25 +19,49 @@
 
 #include "iceoryx_hoofs/cxx/optional.hpp"
 #include "iceoryx_hoofs/cxx/vector.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
+#include "iceoryx_hoofs/internal/relocatable_pointer/relative_pointer.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_storage.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/application_port.hpp"
 #include "iceoryx_posh/internal/popo/ports/interface_port.hpp"
 #include "iceoryx_posh/internal/popo/ports/publisher_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_data.hpp"
 #include "iceoryx_posh/internal/runtime/node_data.hpp"
+#include "iceoryx_posh/roudi/roudi_config.hpp"
+
+#include <algorithm>
 
 namespace iox
 {
 namespace roudi
 {
 /// @brief workaround container until we have a fixed list with the needed functionality
+/// @note the elements are stored in memory provided by an allocator; the runtime capacity is limited by the compile
+///       time Capacity which is also the capacity of the vector returned by content()
 template <typename T, uint64_t Capacity>
 class FixedPositionContainer
 {
   public:
     static constexpr uint64_t FIRST_ELEMENT = std::numeric_limits<uint64_t>::max();
 
+    /// @brief creates the container with the memory for the elements acquired from the allocator
+    /// @param[in] capacity of the container, it is limited to the compile time Capacity
+    /// @param[in] allocator to acquire the memory for the elements
+    FixedPositionContainer(const uint64_t capacity, posix::Allocator& allocator) noexcept;
+    ~FixedPositionContainer() noexcept;
+
+    FixedPositionContainer(const FixedPositionContainer&) = delete;
+    FixedPositionContainer(FixedPositionContainer&&) = delete;
+    FixedPositionContainer& operator=(const FixedPositionContainer&) = delete;
+    FixedPositionContainer& operator=(FixedPositionContainer&&) = delete;
+
+    /// @brief returns the memory which needs to be provided by the allocator for a container with the given capacity
+    static uint64_t requiredMemorySize(const uint64_t capacity) noexcept;
+
+    uint64_t capacity() const noexcept;
+
     bool hasFreeSpace();
 
     template <typename... Targs>
@@ -48,11 +72,28 @@ class FixedPositionContainer
     cxx::vector<T*, Capacity> content();
 
   private:
-    cxx::vector<cxx::optional<T>, Capacity> m_data;
+    /// @brief the container lives in shared memory, therefore the elements are referenced by a relative pointer
+    rp::RelativePointer<cxx::optional<T>> m_data;
+    uint64_t m_capacity{0U};
+    /// @brief the number of positions which were used at least once
+    uint64_t m_size{0U};
 };
 
 struct PortPoolData
 {
+    using SubscriberQueueStoragePool_t =
+        popo::ChunkQueueStoragePool<popo::SubscriberPortData::ChunkQueueData_t::MAX_CAPACITY>;
+
+    /// @brief creates the port pool with the capacities from the config
+    /// @param[in] config with the capacities of the port pool
+    /// @param[in] allocator to acquire the memory for the ports, it must be able to provide requiredMemorySize(config)
+    PortPoolData(const config::PortPoolConfig& config, posix::Allocator& allocator) noexcept;
+
+    /// @brief returns the memory needed for the ports in addition to sizeof(PortPoolData)
+    static uint64_t requiredMemorySize(const config::PortPoolConfig& config) noexcept;
+
+    const config::PortPoolConfig m_config;
+
     FixedPositionContainer<popo::InterfacePortData, MAX_INTERFACE_NUMBER> m_interfacePortMembers;
     FixedPositionContainer<popo::ApplicationPortData, MAX_PROCESS_NUMBER> m_applicationPortMembers;
     FixedPositionContainer<runtime::NodeData, MAX_NODE_NUMBER> m_nodeMembers;
@@ -60,6 +101,7 @@ struct PortPoolData
 
     FixedPositionContainer<iox::popo::PublisherPortData, MAX_PUBLISHERS> m_publisherPortMembers;
     FixedPositionContainer<iox::popo::SubscriberPortData, MAX_SUBSCRIBERS> m_subscriberPortMembers;
+    SubscriberQueueStoragePool_t m_subscriberQueueStoragePool;
 
     // required to be atomic since a service can be offered or stopOffered while reading
     // this variable in a user application
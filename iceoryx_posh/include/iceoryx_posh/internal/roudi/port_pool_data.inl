@@ -20,17 +20,53 @@ namespace iox
 {
 namespace roudi
 {
+template <typename T, uint64_t Capacity>
+FixedPositionContainer<T, Capacity>::FixedPositionContainer(const uint64_t capacity,
+                                                            posix::Allocator& allocator) noexcept
+    : m_capacity(std::min(capacity, Capacity))
+{
+    if (m_capacity > 0U)
+    {
+        m_data = static_cast<cxx::optional<T>*>(
+            allocator.allocate(m_capacity * sizeof(cxx::optional<T>), alignof(cxx::optional<T>)));
+    }
+}
+
+template <typename T, uint64_t Capacity>
+FixedPositionContainer<T, Capacity>::~FixedPositionContainer() noexcept
+{
+    cxx::optional<T>* data = m_data.get();
+    for (uint64_t i = 0U; i < m_size; ++i)
+    {
+        data[i].~optional();
+    }
+}
+
+template <typename T, uint64_t Capacity>
+uint64_t FixedPositionContainer<T, Capacity>::requiredMemorySize(const uint64_t capacity) noexcept
+{
+    // the allocator might need to pad the memory in order to align it
+    return std::min(capacity, Capacity) * sizeof(cxx::optional<T>) + alignof(cxx::optional<T>);
+}
+
+template <typename T, uint64_t Capacity>
+uint64_t FixedPositionContainer<T, Capacity>::capacity() const noexcept
+{
+    return m_capacity;
+}
+
 template <typename T, uint64_t Capacity>
 bool FixedPositionContainer<T, Capacity>::hasFreeSpace()
 {
-    if (m_data.capacity() > m_data.size())
+    if (m_capacity > m_size)
     {
         return true;
     }
 
-    for (auto& e : m_data)
+    cxx::optional<T>* data = m_data.get();
+    for (uint64_t i = 0U; i < m_size; ++i)
     {
-        if (!e.has_value())
+        if (!data[i].has_value())
         {
             return true;
         }
@@ -43,28 +79,32 @@ template <typename T, uint64_t Capacity>
 template <typename... Targs>
 T* FixedPositionContainer<T, Capacity>::insert(Targs&&... args)
 {
-    for (auto& e : m_data)
+    cxx::optional<T>* data = m_data.get();
+    for (uint64_t i = 0U; i < m_size; ++i)
     {
-        if (!e.has_value())
+        if (!data[i].has_value())
         {
-            e.emplace(std::forward<Targs>(args)...);
-            return &e.value();
+            data[i].emplace(std::forward<Targs>(args)...);
+            return &data[i].value();
         }
     }
 
-    m_data.emplace_back();
-    m_data.back().emplace(std::forward<Targs>(args)...);
-    return &m_data.back().value();
+    new (&data[m_size]) cxx::optional<T>();
+    auto& element = data[m_size];
+    ++m_size;
+    element.emplace(std::forward<Targs>(args)...);
+    return &element.value();
 }
 
 template <typename T, uint64_t Capacity>
 void FixedPositionContainer<T, Capacity>::erase(T* const element)
 {
-    for (auto& e : m_data)
+    cxx::optional<T>* data = m_data.get();
+    for (uint64_t i = 0U; i < m_size; ++i)
     {
-        if (e.has_value() && &e.value() == element)
+        if (data[i].has_value() && &data[i].value() == element)
         {
-            e.reset();
+            data[i].reset();
             return;
         }
     }
@@ -74,11 +114,12 @@ template <typename T, uint64_t Capacity>
 cxx::vector<T*, Capacity> FixedPositionContainer<T, Capacity>::content()
 {
     cxx::vector<T*, Capacity> returnValue;
-    for (auto& e : m_data)
+    cxx::optional<T>* data = m_data.get();
+    for (uint64_t i = 0U; i < m_size; ++i)
     {
-        if (e.has_value())
+        if (data[i].has_value())
         {
-            returnValue.emplace_back(&e.value());
+            returnValue.emplace_back(&data[i].value());
         }
     }
     return returnValue;
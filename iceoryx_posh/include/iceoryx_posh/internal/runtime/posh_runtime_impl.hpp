@@ -111,9 +111,14 @@ class PoshRuntimeImpl : public PoshRuntime
     void sendKeepAliveAndHandleShutdownPreparation() noexcept;
     static_assert(PROCESS_KEEP_ALIVE_INTERVAL > roudi::DISCOVERY_INTERVAL, "Keep alive interval too small");
 
+    // the keep alive callback blocks on the IPC channel when the shutdown preparation is sent to RouDi, therefore it
+    // must not run on the process wide TimerWheel which is shared with all other timers of the application
+    concurrent::TimerWheel m_keepAliveTimerWheel{concurrent::TimerWheel::DEFAULT_RESOLUTION, "KeepAlive"};
+
     // the m_keepAliveTask should always be the last member, so that it will be the first member to be destroyed
     concurrent::PeriodicTask<cxx::MethodCallback<void>> m_keepAliveTask{
         concurrent::PeriodicTaskAutoStart,
+        m_keepAliveTimerWheel,
         PROCESS_KEEP_ALIVE_INTERVAL,
         "KeepAlive",
         *this,
@@ -86,13 +86,15 @@ class PortPool
     iox::popo::SubscriberPortData* constructSubscriber(const capro::ServiceDescription& serviceDescription,
                                                        const RuntimeName_t& runtimeName,
                                                        const popo::SubscriberOptions& subscriberOptions,
-                                                       const mepoo::MemoryInfo& memoryInfo) noexcept;
+                                                       const mepoo::MemoryInfo& memoryInfo,
+                                                       const popo::ChunkQueueMemory& queueMemory) noexcept;
 
     template <typename T, std::enable_if_t<std::is_same<T, iox::build::OneToManyPolicy>::value>* = nullptr>
     iox::popo::SubscriberPortData* constructSubscriber(const capro::ServiceDescription& serviceDescription,
                                                        const RuntimeName_t& runtimeName,
                                                        const popo::SubscriberOptions& subscriberOptions,
-                                                       const mepoo::MemoryInfo& memoryInfo) noexcept;
+                                                       const mepoo::MemoryInfo& memoryInfo,
+                                                       const popo::ChunkQueueMemory& queueMemory) noexcept;
 
     cxx::expected<popo::InterfacePortData*, PortPoolError> addInterfacePort(const RuntimeName_t& runtimeName,
                                                                             const capro::Interfaces interface) noexcept;
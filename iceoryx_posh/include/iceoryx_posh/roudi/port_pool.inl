@@ -25,7 +25,8 @@ template <typename T, std::enable_if_t<std::is_same<T, iox::build::ManyToManyPol
 inline iox::popo::SubscriberPortData* PortPool::constructSubscriber(const capro::ServiceDescription& serviceDescription,
                                                                     const RuntimeName_t& runtimeName,
                                                                     const popo::SubscriberOptions& subscriberOptions,
-                                                                    const mepoo::MemoryInfo& memoryInfo) noexcept
+                                                                    const mepoo::MemoryInfo& memoryInfo,
+                                                                    const popo::ChunkQueueMemory& queueMemory) noexcept
 {
     return m_portPoolData->m_subscriberPortMembers.insert(
         serviceDescription,
@@ -34,6 +35,7 @@ inline iox::popo::SubscriberPortData* PortPool::constructSubscriber(const capro:
             ? cxx::VariantQueueTypes::SoFi_MultiProducerSingleConsumer
             : cxx::VariantQueueTypes::FiFo_MultiProducerSingleConsumer,
         subscriberOptions,
+        queueMemory,
         memoryInfo);
 }
 
@@ -41,7 +43,8 @@ template <typename T, std::enable_if_t<std::is_same<T, iox::build::OneToManyPoli
 inline iox::popo::SubscriberPortData* PortPool::constructSubscriber(const capro::ServiceDescription& serviceDescription,
                                                                     const RuntimeName_t& runtimeName,
                                                                     const popo::SubscriberOptions& subscriberOptions,
-                                                                    const mepoo::MemoryInfo& memoryInfo) noexcept
+                                                                    const mepoo::MemoryInfo& memoryInfo,
+                                                                    const popo::ChunkQueueMemory& queueMemory) noexcept
 {
     return m_portPoolData->m_subscriberPortMembers.insert(
         serviceDescription,
@@ -50,6 +53,7 @@ inline iox::popo::SubscriberPortData* PortPool::constructSubscriber(const capro:
             ? cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer
             : cxx::VariantQueueTypes::FiFo_SingleProducerSingleConsumer,
         subscriberOptions,
+        queueMemory,
         memoryInfo);
 }
 } // namespace roudi
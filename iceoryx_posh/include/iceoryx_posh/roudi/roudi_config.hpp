@@ -24,10 +24,40 @@ namespace iox
 {
 namespace config
 {
+/// @brief The capacities for which RouDi lays out the port pool in the management segment at startup. The compile time
+/// limits from iceoryx_posh_deployment.hpp are the upper bounds of these values, lower numbers of ports reduce the
+/// footprint of the management segment. The publisher history and queue capacity limits do not change the memory layout,
+/// the memory for the subscriber queues is defined by the number of subscribers and the subscriber queue entries.
+struct PortPoolConfig
+{
+    uint32_t m_maxPublishers{MAX_PUBLISHERS};
+    uint32_t m_maxSubscribers{MAX_SUBSCRIBERS};
+    uint32_t m_maxInterfaces{MAX_INTERFACE_NUMBER};
+    uint32_t m_maxApplications{MAX_PROCESS_NUMBER};
+    uint32_t m_maxNodes{MAX_NODE_NUMBER};
+    uint32_t m_maxConditionVariables{MAX_NUMBER_OF_CONDITION_VARIABLES};
+    /// @brief the history capacity requested by a publisher is limited to this value; the storage is not reduced
+    uint64_t m_maxPublisherHistory{MAX_PUBLISHER_HISTORY};
+    /// @brief the queue capacity requested by a subscriber is limited to this value
+    uint64_t m_maxSubscriberQueueCapacity{MAX_SUBSCRIBER_QUEUE_CAPACITY};
+    /// @brief the memory which is shared by the queues of all subscribers is sized for this number of entries in queues
+    /// with the compile time maximum capacity, smaller queues need more memory per entry. In addition every subscriber
+    /// has a reserved queue with a capacity of one. The default provides a queue with the maximum capacity for every
+    /// subscriber, values above m_maxSubscribers * MAX_SUBSCRIBER_QUEUE_CAPACITY have no effect.
+    uint64_t m_subscriberQueueEntries{static_cast<uint64_t>(MAX_SUBSCRIBERS) * MAX_SUBSCRIBER_QUEUE_CAPACITY};
+
+    /// @brief checks the capacities against the compile time limits
+    /// @return true if all capacities are within their compile time limit and only the publisher history is zero,
+    /// otherwise false
+    bool isValid() const noexcept;
+};
+
 struct RouDiConfig
 {
     RouDiConfig& setDefaults();
     RouDiConfig& optimize();
+
+    PortPoolConfig m_portPoolConfig;
 };
 } // namespace config
 } // namespace iox
@@ -35,6 +35,7 @@ namespace roudi
 /// MAX_NUMBER_OF_MEMPOOLS_PER_SEGMENT_EXCEEDED - the max number of mempools per segment is exceeded
 /// MEMPOOL_WITHOUT_CHUNK_SIZE - chunk size not specified for the mempool
 /// MEMPOOL_WITHOUT_CHUNK_COUNT - chunk count not specified for the mempool
+/// MAX_PORT_POOL_CAPACITY_EXCEEDED - a capacity of the port pool exceeds its compile time limit
 enum class RouDiConfigFileParseError
 {
     INVALID_STATE,
@@ -46,6 +47,8 @@ enum class RouDiConfigFileParseError
     MAX_NUMBER_OF_MEMPOOLS_PER_SEGMENT_EXCEEDED,
     MEMPOOL_WITHOUT_CHUNK_SIZE,
     MEMPOOL_WITHOUT_CHUNK_COUNT,
+    MAX_PORT_POOL_CAPACITY_EXCEEDED,
+    INVALID_PORT_POOL_CAPACITY,
     EXCEPTION_IN_PARSER
 };
 
@@ -58,6 +61,8 @@ constexpr const char* ROUDI_CONFIG_FILE_PARSE_ERROR_STRINGS[] = {"INVALID_STATE"
                                                                  "MAX_NUMBER_OF_MEMPOOLS_PER_SEGMENT_EXCEEDED",
                                                                  "MEMPOOL_WITHOUT_CHUNK_SIZE",
                                                                  "MEMPOOL_WITHOUT_CHUNK_COUNT",
+                                                                 "MAX_PORT_POOL_CAPACITY_EXCEEDED",
+                                                                 "INVALID_PORT_POOL_CAPACITY",
                                                                  "EXCEPTION_IN_PARSER"};
 
 /// @brief Base class for a config file provider.
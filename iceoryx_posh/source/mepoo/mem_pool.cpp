@@ -44,9 +44,9 @@ MemPool::MemPool(const cxx::greater_or_equal<uint32_t, CHUNK_MEMORY_ALIGNMENT> c
                  const cxx::greater_or_equal<uint32_t, 1> numberOfChunks,
                  posix::Allocator& managementAllocator,
                  posix::Allocator& chunkMemoryAllocator) noexcept
-    : m_chunkSize(chunkSize)
+    : m_minFree(numberOfChunks)
+    , m_chunkSize(chunkSize)
     , m_numberOfChunks(numberOfChunks)
-    , m_minFree(numberOfChunks)
 {
     if (isMultipleOfAlignment(chunkSize))
     {
@@ -29,19 +29,9 @@ ConditionListener::ConditionListener(ConditionVariableData& condVarData) noexcep
 
 void ConditionListener::resetSemaphore() noexcept
 {
-    // Count the semaphore down to zero
-    bool hasFatalError = false;
-    while (!hasFatalError
-           && getMembers()
-                  ->m_semaphore.tryWait()
-                  .or_else([&](posix::SemaphoreError) {
-                      errorHandler(
-                          Error::kPOPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_RESET, nullptr, ErrorLevel::FATAL);
-                      hasFatalError = true;
-                  })
-                  .value())
-    {
-    }
+    getMembers()->m_semaphore.reset().or_else([](posix::SemaphoreError) {
+        errorHandler(Error::kPOPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_RESET, nullptr, ErrorLevel::FATAL);
+    });
 }
 
 void ConditionListener::destroy() noexcept
@@ -54,14 +44,14 @@ void ConditionListener::destroy() noexcept
 
 bool ConditionListener::wasNotified() const noexcept
 {
-    auto result = getMembers()->m_semaphore.getValue();
+    auto result = getMembers()->m_semaphore.isPosted();
     if (result.has_error())
     {
         errorHandler(Error::kPOPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_WAS_TRIGGERED, nullptr, ErrorLevel::FATAL);
         return false;
     }
 
-    return *result != 0;
+    return *result;
 }
 
 ConditionListener::NotificationVector_t ConditionListener::wait() noexcept
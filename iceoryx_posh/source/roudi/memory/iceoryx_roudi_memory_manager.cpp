@@ -22,7 +22,8 @@ namespace iox
 namespace roudi
 {
 IceOryxRouDiMemoryManager::IceOryxRouDiMemoryManager(const RouDiConfig_t& roudiConfig) noexcept
-    : m_defaultMemory(roudiConfig)
+    : m_portPoolBlock(roudiConfig.m_portPoolConfig)
+    , m_defaultMemory(roudiConfig)
 {
     m_defaultMemory.m_managementShm.addMemoryBlock(&m_portPoolBlock).or_else([](auto) {
         errorHandler(
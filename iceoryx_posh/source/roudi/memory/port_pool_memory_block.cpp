@@ -18,12 +18,18 @@
 
 #include "iceoryx_posh/internal/roudi/port_pool_data.hpp"
 
+#include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
 
 namespace iox
 {
 namespace roudi
 {
+PortPoolMemoryBlock::PortPoolMemoryBlock(const config::PortPoolConfig& portPoolConfig) noexcept
+    : m_portPoolConfig(portPoolConfig)
+{
+}
+
 PortPoolMemoryBlock::~PortPoolMemoryBlock() noexcept
 {
     destroy();
@@ -31,7 +37,8 @@ PortPoolMemoryBlock::~PortPoolMemoryBlock() noexcept
 
 uint64_t PortPoolMemoryBlock::size() const noexcept
 {
-    return sizeof(PortPoolData);
+    return cxx::align(static_cast<uint64_t>(sizeof(PortPoolData)), static_cast<uint64_t>(alignof(PortPoolData)))
+           + PortPoolData::requiredMemorySize(m_portPoolConfig);
 }
 
 uint64_t PortPoolMemoryBlock::alignment() const noexcept
@@ -41,7 +48,9 @@ uint64_t PortPoolMemoryBlock::alignment() const noexcept
 
 void PortPoolMemoryBlock::memoryAvailable(void* memory) noexcept
 {
-    m_portPoolData = new (memory) PortPoolData;
+    posix::Allocator allocator(memory, size());
+    auto portPoolData = allocator.allocate(sizeof(PortPoolData), alignof(PortPoolData));
+    m_portPoolData = new (portPoolData) PortPoolData(m_portPoolConfig, allocator);
 }
 
 void PortPoolMemoryBlock::destroy() noexcept
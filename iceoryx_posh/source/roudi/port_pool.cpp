@@ -17,6 +17,7 @@
 
 #include "iceoryx_posh/roudi/port_pool.hpp"
 #include "iceoryx_hoofs/cxx/string.hpp"
+#include "iceoryx_posh/internal/log/posh_logging.hpp"
 #include "iceoryx_posh/internal/roudi/port_pool_data.hpp"
 
 namespace iox
@@ -154,8 +155,18 @@ PortPool::addPublisherPort(const capro::ServiceDescription& serviceDescription,
 {
     if (m_portPoolData->m_publisherPortMembers.hasFreeSpace())
     {
+        auto options = publisherOptions;
+        const auto maxHistory = m_portPoolData->m_config.m_maxPublisherHistory;
+        if (options.historyCapacity > maxHistory)
+        {
+            LogWarn() << "Publisher of '" << runtimeName << "' requested a history capacity of "
+                      << options.historyCapacity << " which exceeds the configured maximum of " << maxHistory
+                      << "! Limiting the history capacity to " << maxHistory << ".";
+            options.historyCapacity = maxHistory;
+        }
+
         auto publisherPortData = m_portPoolData->m_publisherPortMembers.insert(
-            serviceDescription, runtimeName, memoryManager, publisherOptions, memoryInfo);
+            serviceDescription, runtimeName, memoryManager, options, memoryInfo);
         return cxx::success<PublisherPortRouDiType::MemberType_t*>(publisherPortData);
     }
     else
@@ -173,8 +184,32 @@ PortPool::addSubscriberPort(const capro::ServiceDescription& serviceDescription,
 {
     if (m_portPoolData->m_subscriberPortMembers.hasFreeSpace())
     {
+        auto options = subscriberOptions;
+        const auto maxQueueCapacity = m_portPoolData->m_config.m_maxSubscriberQueueCapacity;
+        if (options.queueCapacity > maxQueueCapacity)
+        {
+            LogWarn() << "Subscriber of '" << runtimeName << "' requested a queue capacity of "
+                      << options.queueCapacity << " which exceeds the configured maximum of " << maxQueueCapacity
+                      << "! Limiting the queue capacity to " << maxQueueCapacity << ".";
+            options.queueCapacity = maxQueueCapacity;
+        }
+
+        // the allocation cannot fail since the pool reserves a queue of the smallest capacity class for every subscriber
+        const auto queueMemory =
+            m_portPoolData->m_subscriberQueueStoragePool.allocate(options.queueCapacity).value();
+
+        const auto availableQueueCapacity =
+            PortPoolData::SubscriberQueueStoragePool_t::CapacityClasses_t::capacity(queueMemory.m_capacityClass);
+        if (options.queueCapacity > availableQueueCapacity)
+        {
+            LogWarn() << "Subscriber of '" << runtimeName << "' requested a queue capacity of "
+                      << options.queueCapacity << " but the configured subscriber queue entries are exhausted! "
+                      << "Limiting the queue capacity to " << availableQueueCapacity << ".";
+            options.queueCapacity = availableQueueCapacity;
+        }
+
         auto subscriberPortData = constructSubscriber<iox::build::CommunicationPolicy>(
-            serviceDescription, runtimeName, subscriberOptions, memoryInfo);
+            serviceDescription, runtimeName, options, memoryInfo, queueMemory);
 
         return cxx::success<SubscriberPortType::MemberType_t*>(subscriberPortData);
     }
@@ -192,7 +227,9 @@ void PortPool::removePublisherPort(PublisherPortRouDiType::MemberType_t* const p
 
 void PortPool::removeSubscriberPort(SubscriberPortType::MemberType_t* const portData) noexcept
 {
+    const auto queueMemory = portData->m_chunkReceiverData.m_queue.memory();
     m_portPoolData->m_subscriberPortMembers.erase(portData);
+    m_portPoolData->m_subscriberQueueStoragePool.deallocate(queueMemory);
 }
 
 } // namespace roudi
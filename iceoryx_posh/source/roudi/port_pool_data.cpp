@@ -0,0 +1,58 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/roudi/port_pool_data.hpp"
+
+namespace iox
+{
+namespace roudi
+{
+namespace
+{
+/// more entries than required for a queue with the maximum capacity for every subscriber would never be used
+uint64_t numberOfSubscriberQueueEntries(const config::PortPoolConfig& config) noexcept
+{
+    constexpr uint64_t MAX_QUEUE_CAPACITY{popo::SubscriberPortData::ChunkQueueData_t::MAX_CAPACITY};
+    return std::min(config.m_subscriberQueueEntries, static_cast<uint64_t>(config.m_maxSubscribers) * MAX_QUEUE_CAPACITY);
+}
+} // namespace
+
+PortPoolData::PortPoolData(const config::PortPoolConfig& config, posix::Allocator& allocator) noexcept
+    : m_config(config)
+    , m_interfacePortMembers(config.m_maxInterfaces, allocator)
+    , m_applicationPortMembers(config.m_maxApplications, allocator)
+    , m_nodeMembers(config.m_maxNodes, allocator)
+    , m_conditionVariableMembers(config.m_maxConditionVariables, allocator)
+    , m_publisherPortMembers(config.m_maxPublishers, allocator)
+    , m_subscriberPortMembers(config.m_maxSubscribers, allocator)
+    , m_subscriberQueueStoragePool(config.m_maxSubscribers, numberOfSubscriberQueueEntries(config), allocator)
+{
+}
+
+uint64_t PortPoolData::requiredMemorySize(const config::PortPoolConfig& config) noexcept
+{
+    return decltype(m_interfacePortMembers)::requiredMemorySize(config.m_maxInterfaces)
+           + decltype(m_applicationPortMembers)::requiredMemorySize(config.m_maxApplications)
+           + decltype(m_nodeMembers)::requiredMemorySize(config.m_maxNodes)
+           + decltype(m_conditionVariableMembers)::requiredMemorySize(config.m_maxConditionVariables)
+           + decltype(m_publisherPortMembers)::requiredMemorySize(config.m_maxPublishers)
+           + decltype(m_subscriberPortMembers)::requiredMemorySize(config.m_maxSubscribers)
+           + SubscriberQueueStoragePool_t::requiredMemorySize(config.m_maxSubscribers,
+                                                               numberOfSubscriberQueueEntries(config));
+}
+
+} // namespace roudi
+} // namespace iox
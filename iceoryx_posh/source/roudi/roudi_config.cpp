@@ -20,8 +20,21 @@ namespace iox
 {
 namespace config
 {
+bool PortPoolConfig::isValid() const noexcept
+{
+    // a pool without capacity for a port type would render RouDi unusable; only the publisher history can be disabled
+    return m_maxPublishers > 0U && m_maxPublishers <= MAX_PUBLISHERS && m_maxSubscribers > 0U
+           && m_maxSubscribers <= MAX_SUBSCRIBERS && m_maxInterfaces > 0U && m_maxInterfaces <= MAX_INTERFACE_NUMBER
+           && m_maxApplications > 0U && m_maxApplications <= MAX_PROCESS_NUMBER && m_maxNodes > 0U
+           && m_maxNodes <= MAX_NODE_NUMBER && m_maxConditionVariables > 0U
+           && m_maxConditionVariables <= MAX_NUMBER_OF_CONDITION_VARIABLES
+           && m_maxPublisherHistory <= MAX_PUBLISHER_HISTORY && m_maxSubscriberQueueCapacity > 0U
+           && m_maxSubscriberQueueCapacity <= MAX_SUBSCRIBER_QUEUE_CAPACITY;
+}
+
 RouDiConfig& RouDiConfig::setDefaults()
 {
+    m_portPoolConfig = PortPoolConfig();
     return *this;
 }
 
@@ -148,6 +148,53 @@ iox::cxx::expected<iox::RouDiConfig_t, iox::roudi::RouDiConfigFileParseError> To
              mempoolConfig});
     }
 
+    auto portPool = parsedFile->get_table("portpool");
+    if (portPool)
+    {
+        auto& portPoolConfig = parsedConfig.m_portPoolConfig;
+
+        // a key which is not specified keeps its default; a key which is specified but is not an integer in the range
+        // of the capacity type, e.g. a negative value, must not silently fall back to the default
+        bool hasInvalidCapacity{false};
+        auto readCapacity = [&](const std::string& key, auto& capacity, const bool isZeroAllowed) {
+            if (!portPool->contains(key))
+            {
+                return;
+            }
+            using Capacity_t = typename std::remove_reference<decltype(capacity)>::type;
+            auto value = portPool->get_as<Capacity_t>(key);
+            if (!value || (*value == 0U && !isZeroAllowed))
+            {
+                LogError() << "Invalid value for '" << key << "' in the portpool section of the config file";
+                hasInvalidCapacity = true;
+                return;
+            }
+            capacity = *value;
+        };
+
+        readCapacity("publishers", portPoolConfig.m_maxPublishers, false);
+        readCapacity("subscribers", portPoolConfig.m_maxSubscribers, false);
+        readCapacity("interfaces", portPoolConfig.m_maxInterfaces, false);
+        readCapacity("applications", portPoolConfig.m_maxApplications, false);
+        readCapacity("nodes", portPoolConfig.m_maxNodes, false);
+        readCapacity("condition_variables", portPoolConfig.m_maxConditionVariables, false);
+        readCapacity("publisher_history", portPoolConfig.m_maxPublisherHistory, true);
+        readCapacity("subscriber_queue_capacity", portPoolConfig.m_maxSubscriberQueueCapacity, false);
+        readCapacity("subscriber_queue_entries", portPoolConfig.m_subscriberQueueEntries, true);
+
+        if (hasInvalidCapacity)
+        {
+            return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
+                iox::roudi::RouDiConfigFileParseError::INVALID_PORT_POOL_CAPACITY);
+        }
+
+        if (!portPoolConfig.isValid())
+        {
+            return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
+                iox::roudi::RouDiConfigFileParseError::MAX_PORT_POOL_CAPACITY_EXCEEDED);
+        }
+    }
+
     return iox::cxx::success<iox::RouDiConfig_t>(parsedConfig);
 }
 } // namespace config
@@ -540,8 +540,8 @@ void PoshRuntimeImpl::sendKeepAliveAndHandleShutdownPreparation() noexcept
     }
 
     // this is not the nicest solution, but we cannot send this in the signal handler where m_shutdownRequested is
-    // usually set; luckily the runtime already has a thread running and therefore this thread is used to unblock the
-    // application shutdown from a potentially blocking publisher with the
+    // usually set; the keep alive task runs on a TimerWheel which is dedicated to the runtime and therefore its thread
+    // can block on the request which unblocks the application shutdown from a potentially blocking publisher with the
     // SubscriberTooSlowPolicy::WAIT_FOR_SUBSCRIBER option set
     if (m_shutdownRequested.exchange(false, std::memory_order_relaxed))
     {
@@ -120,18 +120,22 @@ class PortUser_IntegrationTest : public Test
     ConcurrentCaproMessageVector_t m_concurrentCaproMessageRx;
 
     // subscriber port for single producer
+    SubscriberPortData::ChunkQueue_t::MaxCapacityMemory_t m_queueMemorySingleProducer;
     SubscriberPortData m_subscriberPortDataSingleProducer{TEST_SERVICE_DESCRIPTION,
                                                           TEST_SUBSCRIBER_RUNTIME_NAME,
                                                           VariantQueueTypes::SoFi_SingleProducerSingleConsumer,
-                                                          SubscriberOptions()};
+                                                          SubscriberOptions(),
+                                                          ChunkQueueMemory{&m_queueMemorySingleProducer, 0U}};
     SubscriberPortUser m_subscriberPortUserSingleProducer{&m_subscriberPortDataSingleProducer};
     SubscriberPortSingleProducer m_subscriberPortRouDiSingleProducer{&m_subscriberPortDataSingleProducer};
 
     // subscriber port for multi producer
+    SubscriberPortData::ChunkQueue_t::MaxCapacityMemory_t m_queueMemoryMultiProducer;
     SubscriberPortData m_subscriberPortDataMultiProducer{TEST_SERVICE_DESCRIPTION,
                                                          TEST_SUBSCRIBER_RUNTIME_NAME,
                                                          VariantQueueTypes::SoFi_MultiProducerSingleConsumer,
-                                                         SubscriberOptions()};
+                                                         SubscriberOptions(),
+                                                         ChunkQueueMemory{&m_queueMemoryMultiProducer, 0U}};
     SubscriberPortUser m_subscriberPortUserMultiProducer{&m_subscriberPortDataMultiProducer};
     SubscriberPortMultiProducer m_subscriberPortRouDiMultiProducer{&m_subscriberPortDataMultiProducer};
 
@@ -78,10 +78,13 @@ PublisherPortData* createPortData()
 template <>
 SubscriberPortData* createPortData()
 {
+    // there is only one port of a type at a time
+    static SubscriberPortData::ChunkQueue_t::MaxCapacityMemory_t queueMemory;
     return new SubscriberPortData(SERVICE_DESCRIPTION_VALID,
                                   RUNTIME_NAME_FOR_SUBSCRIBER_PORTS,
                                   iox::cxx::VariantQueueTypes::FiFo_MultiProducerSingleConsumer,
-                                  SubscriberOptions());
+                                  SubscriberOptions(),
+                                  iox::popo::ChunkQueueMemory{&queueMemory, 0U});
 }
 template <>
 InterfacePortData* createPortData()
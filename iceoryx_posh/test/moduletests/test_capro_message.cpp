@@ -41,8 +41,12 @@ TEST_F(CaproMessage_test, CTorSetsParametersCorrectly)
     constexpr uint16_t testEventID{2U};
     constexpr uint16_t testInstanceID{3U};
     ServiceDescription sd(testServiceID, testEventID, testInstanceID);
-    iox::popo::SubscriberPortData recData{
-        sd, "foo", iox::cxx::VariantQueueTypes::FiFo_MultiProducerSingleConsumer, iox::popo::SubscriberOptions()};
+    iox::popo::SubscriberPortData::ChunkQueue_t::MaxCapacityMemory_t queueMemory;
+    iox::popo::SubscriberPortData recData{sd,
+                                          "foo",
+                                          iox::cxx::VariantQueueTypes::FiFo_MultiProducerSingleConsumer,
+                                          iox::popo::SubscriberOptions(),
+                                          iox::popo::ChunkQueueMemory{&queueMemory, 0U}};
 
     CaproMessage testObj(CaproMessageType::OFFER, sd, CaproMessageSubType::SERVICE, &recData);
 
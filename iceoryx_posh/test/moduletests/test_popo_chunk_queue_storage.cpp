@@ -0,0 +1,313 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_storage.hpp"
+
+#include "test.hpp"
+
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+using iox::cxx::VariantQueueTypes;
+using iox::mepoo::ShmSafeUnmanagedChunk;
+
+constexpr uint64_t MAX_CAPACITY{256U};
+using CapacityClasses = ChunkQueueCapacityClasses<MAX_CAPACITY>;
+using Storage = ChunkQueueStorage<MAX_CAPACITY>;
+using StoragePool = ChunkQueueStoragePool<MAX_CAPACITY>;
+
+constexpr uint64_t SMALLEST_CLASS{NUMBER_OF_CHUNK_QUEUE_CAPACITY_CLASSES - 1U};
+
+class ChunkQueueStoragePool_test : public Test
+{
+  public:
+    void createPool(const uint64_t numberOfQueues, const uint64_t numberOfEntries)
+    {
+        m_memory.resize(StoragePool::requiredMemorySize(numberOfQueues, numberOfEntries));
+        m_allocator.emplace(m_memory.data(), m_memory.size());
+        m_sut.emplace(numberOfQueues, numberOfEntries, m_allocator.value());
+    }
+
+    std::vector<uint8_t> m_memory;
+    iox::cxx::optional<iox::posix::Allocator> m_allocator;
+    iox::cxx::optional<StoragePool> m_sut;
+};
+
+TEST(ChunkQueueCapacityClasses_test, CapacityIsAQuarterOfThePreviousClass)
+{
+    EXPECT_THAT(CapacityClasses::capacity(0U), Eq(256U));
+    EXPECT_THAT(CapacityClasses::capacity(1U), Eq(64U));
+    EXPECT_THAT(CapacityClasses::capacity(2U), Eq(16U));
+    EXPECT_THAT(CapacityClasses::capacity(3U), Eq(4U));
+    EXPECT_THAT(CapacityClasses::capacity(4U), Eq(1U));
+}
+
+TEST(ChunkQueueCapacityClasses_test, CapacityOfSmallMaxCapacityIsAtLeastOne)
+{
+    EXPECT_THAT(ChunkQueueCapacityClasses<8U>::capacity(0U), Eq(8U));
+    EXPECT_THAT(ChunkQueueCapacityClasses<8U>::capacity(1U), Eq(2U));
+    EXPECT_THAT(ChunkQueueCapacityClasses<8U>::capacity(2U), Eq(1U));
+    EXPECT_THAT(ChunkQueueCapacityClasses<8U>::capacity(SMALLEST_CLASS), Eq(1U));
+}
+
+TEST(ChunkQueueCapacityClasses_test, ClassForCapacityIsSmallestClassWhichCanHoldTheCapacity)
+{
+    EXPECT_THAT(CapacityClasses::classFor(0U), Eq(SMALLEST_CLASS));
+    EXPECT_THAT(CapacityClasses::classFor(1U), Eq(SMALLEST_CLASS));
+    EXPECT_THAT(CapacityClasses::classFor(2U), Eq(3U));
+    EXPECT_THAT(CapacityClasses::classFor(16U), Eq(2U));
+    EXPECT_THAT(CapacityClasses::classFor(17U), Eq(1U));
+    EXPECT_THAT(CapacityClasses::classFor(256U), Eq(0U));
+    EXPECT_THAT(CapacityClasses::classFor(1000U), Eq(0U));
+}
+
+TEST(ChunkQueueCapacityClasses_test, MemorySizeShrinksWithCapacityClass)
+{
+    for (uint64_t capacityClass = 1U; capacityClass < NUMBER_OF_CHUNK_QUEUE_CAPACITY_CLASSES; ++capacityClass)
+    {
+        EXPECT_THAT(CapacityClasses::memorySize(capacityClass), Lt(CapacityClasses::memorySize(capacityClass - 1U)));
+        EXPECT_THAT(CapacityClasses::memorySize(capacityClass) % CapacityClasses::alignment(), Eq(0U));
+    }
+    EXPECT_THAT(CapacityClasses::memorySize(0U),
+                Ge(sizeof(iox::cxx::VariantQueue<ShmSafeUnmanagedChunk, MAX_CAPACITY>)));
+}
+
+TEST(ChunkQueueStorage_test, QueueHasCapacityOfCapacityClassOfMemory)
+{
+    Storage::MaxCapacityMemory_t memory;
+    Storage sut(VariantQueueTypes::SoFi_MultiProducerSingleConsumer, ChunkQueueMemory{&memory, 3U});
+
+    EXPECT_THAT(sut.capacity(), Eq(4U));
+    EXPECT_THAT(sut.maxCapacity(), Eq(4U));
+    EXPECT_THAT(sut.memory().m_capacityClass, Eq(3U));
+    EXPECT_THAT(sut.memory().m_memory, Eq(static_cast<void*>(&memory)));
+}
+
+TEST(ChunkQueueStorage_test, QueueInMaxCapacityMemoryUsesBiggestClass)
+{
+    Storage::MaxCapacityMemory_t memory;
+    Storage sut(VariantQueueTypes::FiFo_SingleProducerSingleConsumer, ChunkQueueMemory{&memory, 0U});
+
+    EXPECT_THAT(sut.capacity(), Eq(MAX_CAPACITY));
+    EXPECT_THAT(sizeof(memory), Eq(CapacityClasses::memorySize(0U)));
+}
+
+TEST(ChunkQueueStorage_test, PushAndPopAreDispatchedToTheQueueOfTheCapacityClass)
+{
+    Storage::MaxCapacityMemory_t memory;
+    Storage sut(VariantQueueTypes::FiFo_MultiProducerSingleConsumer, ChunkQueueMemory{&memory, 3U});
+    ASSERT_TRUE(sut.setCapacity(2U));
+    ShmSafeUnmanagedChunk chunk;
+
+    EXPECT_TRUE(sut.empty());
+    EXPECT_FALSE(sut.push(chunk).has_value());
+    EXPECT_FALSE(sut.push(chunk).has_value());
+    EXPECT_THAT(sut.size(), Eq(2U));
+    EXPECT_TRUE(sut.push(chunk).has_value());
+
+    EXPECT_TRUE(sut.pop().has_value());
+    EXPECT_TRUE(sut.pop().has_value());
+    EXPECT_FALSE(sut.pop().has_value());
+    EXPECT_TRUE(sut.empty());
+}
+
+TEST(ChunkQueueStorage_test, SetCapacityIsLimitedByCapacityClass)
+{
+    Storage::MaxCapacityMemory_t memory;
+    Storage sut(VariantQueueTypes::SoFi_SingleProducerSingleConsumer, ChunkQueueMemory{&memory, 2U});
+
+    EXPECT_FALSE(sut.setCapacity(17U));
+    EXPECT_THAT(sut.capacity(), Eq(16U));
+    EXPECT_TRUE(sut.setCapacity(5U));
+    EXPECT_THAT(sut.capacity(), Eq(5U));
+}
+
+TEST_F(ChunkQueueStoragePool_test, AllocatesSmallestClassWhichCanHoldTheCapacity)
+{
+    createPool(4U, 64U);
+
+    auto memory = m_sut->allocate(3U);
+
+    ASSERT_TRUE(memory.has_value());
+    EXPECT_THAT(memory->m_capacityClass, Eq(3U));
+    EXPECT_THAT(reinterpret_cast<uintptr_t>(memory->m_memory) % CapacityClasses::alignment(), Eq(0U));
+}
+
+TEST_F(ChunkQueueStoragePool_test, EveryQueueGetsAtLeastTheSmallestClassWhenNoEntriesAreConfigured)
+{
+    constexpr uint64_t NUMBER_OF_QUEUES{8U};
+    createPool(NUMBER_OF_QUEUES, 0U);
+
+    for (uint64_t i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        auto memory = m_sut->allocate(MAX_CAPACITY);
+        ASSERT_TRUE(memory.has_value());
+        EXPECT_THAT(memory->m_capacityClass, Eq(SMALLEST_CLASS));
+    }
+}
+
+TEST_F(ChunkQueueStoragePool_test, AllocateFailsWhenPoolIsExhausted)
+{
+    createPool(1U, 0U);
+
+    EXPECT_TRUE(m_sut->allocate(1U).has_value());
+    EXPECT_FALSE(m_sut->allocate(1U).has_value());
+}
+
+TEST_F(ChunkQueueStoragePool_test, DeallocatedMemoryIsReused)
+{
+    createPool(1U, 0U);
+
+    auto memory = m_sut->allocate(1U);
+    ASSERT_TRUE(memory.has_value());
+    m_sut->deallocate(memory.value());
+
+    auto reusedMemory = m_sut->allocate(1U);
+    ASSERT_TRUE(reusedMemory.has_value());
+    EXPECT_THAT(reusedMemory->m_memory, Eq(memory->m_memory));
+}
+
+TEST_F(ChunkQueueStoragePool_test, SmallestClassIsTakenFromReservedSlotsBeforeSharedMemory)
+{
+    createPool(1U, MAX_CAPACITY);
+
+    auto smallQueue = m_sut->allocate(1U);
+    auto bigQueue = m_sut->allocate(MAX_CAPACITY);
+
+    ASSERT_TRUE(smallQueue.has_value());
+    ASSERT_TRUE(bigQueue.has_value());
+    EXPECT_THAT(smallQueue->m_capacityClass, Eq(SMALLEST_CLASS));
+    EXPECT_THAT(bigQueue->m_capacityClass, Eq(0U));
+}
+
+TEST_F(ChunkQueueStoragePool_test, ReservedSlotIsUsedWhenSharedMemoryIsExhausted)
+{
+    createPool(2U, MAX_CAPACITY);
+
+    auto firstQueue = m_sut->allocate(MAX_CAPACITY);
+    auto secondQueue = m_sut->allocate(MAX_CAPACITY);
+
+    ASSERT_TRUE(firstQueue.has_value());
+    ASSERT_TRUE(secondQueue.has_value());
+    EXPECT_THAT(firstQueue->m_capacityClass, Eq(0U));
+    EXPECT_THAT(secondQueue->m_capacityClass, Eq(SMALLEST_CLASS));
+}
+
+TEST_F(ChunkQueueStoragePool_test, BlockIsSharedByQueuesOfTheSameCapacityClass)
+{
+    createPool(0U, MAX_CAPACITY);
+    const uint64_t queuesPerBlock = CapacityClasses::memorySize(0U) / CapacityClasses::memorySize(2U);
+
+    for (uint64_t i = 0U; i < queuesPerBlock; ++i)
+    {
+        auto memory = m_sut->allocate(16U);
+        ASSERT_TRUE(memory.has_value());
+        EXPECT_THAT(memory->m_capacityClass, Eq(2U));
+    }
+    EXPECT_FALSE(m_sut->allocate(16U).has_value());
+}
+
+TEST_F(ChunkQueueStoragePool_test, QueueGetsBiggestAvailableClassWhenRequestedClassIsExhausted)
+{
+    createPool(0U, MAX_CAPACITY);
+
+    auto smallQueue = m_sut->allocate(4U);
+    auto bigQueue = m_sut->allocate(MAX_CAPACITY);
+
+    ASSERT_TRUE(smallQueue.has_value());
+    ASSERT_TRUE(bigQueue.has_value());
+    EXPECT_THAT(bigQueue->m_capacityClass, Eq(3U));
+}
+
+TEST_F(ChunkQueueStoragePool_test, ReleasedBlockIsReusedByAnotherCapacityClass)
+{
+    createPool(0U, MAX_CAPACITY);
+
+    auto bigQueue = m_sut->allocate(MAX_CAPACITY);
+    ASSERT_TRUE(bigQueue.has_value());
+    ASSERT_THAT(bigQueue->m_capacityClass, Eq(0U));
+    m_sut->deallocate(bigQueue.value());
+
+    std::vector<ChunkQueueMemory> smallQueues;
+    while (auto memory = m_sut->allocate(16U))
+    {
+        EXPECT_THAT(memory->m_capacityClass, Eq(2U));
+        smallQueues.push_back(memory.value());
+    }
+    ASSERT_FALSE(smallQueues.empty());
+    EXPECT_THAT(smallQueues.front().m_memory, Eq(bigQueue->m_memory));
+
+    for (const auto& memory : smallQueues)
+    {
+        m_sut->deallocate(memory);
+    }
+
+    auto reusedQueue = m_sut->allocate(MAX_CAPACITY);
+    ASSERT_TRUE(reusedQueue.has_value());
+    EXPECT_THAT(reusedQueue->m_capacityClass, Eq(0U));
+    EXPECT_THAT(reusedQueue->m_memory, Eq(bigQueue->m_memory));
+}
+
+TEST_F(ChunkQueueStoragePool_test, PartiallyUsedBlockIsNotReleased)
+{
+    createPool(0U, MAX_CAPACITY);
+
+    auto firstQueue = m_sut->allocate(16U);
+    auto secondQueue = m_sut->allocate(16U);
+    ASSERT_TRUE(firstQueue.has_value());
+    ASSERT_TRUE(secondQueue.has_value());
+    m_sut->deallocate(firstQueue.value());
+
+    auto bigQueue = m_sut->allocate(MAX_CAPACITY);
+    ASSERT_TRUE(bigQueue.has_value());
+    EXPECT_THAT(bigQueue->m_capacityClass, Eq(2U));
+    EXPECT_THAT(bigQueue->m_memory, Eq(firstQueue->m_memory));
+}
+
+TEST_F(ChunkQueueStoragePool_test, QueuesInTheMemoryOfThePoolCanBeUsed)
+{
+    createPool(2U, MAX_CAPACITY);
+    auto bigQueueMemory = m_sut->allocate(MAX_CAPACITY);
+    auto smallQueueMemory = m_sut->allocate(1U);
+    ASSERT_TRUE(bigQueueMemory.has_value());
+    ASSERT_TRUE(smallQueueMemory.has_value());
+
+    Storage bigQueue(VariantQueueTypes::FiFo_SingleProducerSingleConsumer, bigQueueMemory.value());
+    Storage smallQueue(VariantQueueTypes::SoFi_SingleProducerSingleConsumer, smallQueueMemory.value());
+    ShmSafeUnmanagedChunk chunk;
+
+    for (uint64_t i = 0U; i < MAX_CAPACITY; ++i)
+    {
+        EXPECT_FALSE(bigQueue.push(chunk).has_value());
+    }
+    EXPECT_FALSE(smallQueue.push(chunk).has_value());
+    EXPECT_THAT(bigQueue.size(), Eq(MAX_CAPACITY));
+    EXPECT_THAT(smallQueue.size(), Eq(1U));
+}
+
+TEST_F(ChunkQueueStoragePool_test, RequiredMemoryOfSmallQueuesIsFarBelowTheMaxCapacityQueues)
+{
+    constexpr uint64_t NUMBER_OF_QUEUES{1000U};
+
+    EXPECT_THAT(StoragePool::requiredMemorySize(NUMBER_OF_QUEUES, 0U) * 10U,
+                Lt(NUMBER_OF_QUEUES * CapacityClasses::memorySize(0U)));
+}
+
+} // namespace
@@ -63,20 +63,24 @@ class SubscriberPortSingleProducer_test : public Test
 
     iox::popo::SubscriberOptions m_noSubscribeOnCreateOptions{
         iox::popo::SubscriberPortData::ChunkQueueData_t::MAX_CAPACITY, 0U, iox::NodeName_t(""), false};
+    iox::popo::SubscriberPortData::ChunkQueue_t::MaxCapacityMemory_t m_queueMemorySingleProducer;
     iox::popo::SubscriberPortData m_subscriberPortDataSingleProducer{
         TEST_SERVICE_DESCRIPTION,
         "myApp",
         iox::cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer,
-        m_noSubscribeOnCreateOptions};
+        m_noSubscribeOnCreateOptions,
+        iox::popo::ChunkQueueMemory{&m_queueMemorySingleProducer, 0U}};
     iox::popo::SubscriberPortUser m_sutUserSideSingleProducer{&m_subscriberPortDataSingleProducer};
     iox::popo::SubscriberPortSingleProducer m_sutRouDiSideSingleProducer{&m_subscriberPortDataSingleProducer};
 
     iox::popo::SubscriberOptions m_defaultSubscriberOptions{};
+    iox::popo::SubscriberPortData::ChunkQueue_t::MaxCapacityMemory_t m_queueMemoryDefaultOptions;
     iox::popo::SubscriberPortData m_subscriberPortDataDefaultOptions{
         TEST_SERVICE_DESCRIPTION,
         "myApp",
         iox::cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer,
-        m_defaultSubscriberOptions};
+        m_defaultSubscriberOptions,
+        iox::popo::ChunkQueueMemory{&m_queueMemoryDefaultOptions, 0U}};
     iox::popo::SubscriberPortUser m_sutUserSideDefaultOptions{&m_subscriberPortDataDefaultOptions};
     iox::popo::SubscriberPortSingleProducer m_sutRouDiSideDefaultOptions{&m_subscriberPortDataDefaultOptions};
 };
@@ -370,11 +374,13 @@ class SubscriberPortMultiProducer_test : public Test
 
     iox::cxx::GenericRAII m_uniqueRouDiId{[] { iox::popo::internal::setUniqueRouDiId(0); },
                                           [] { iox::popo::internal::unsetUniqueRouDiId(); }};
+    iox::popo::SubscriberPortData::ChunkQueue_t::MaxCapacityMemory_t m_queueMemoryMultiProducer;
     iox::popo::SubscriberPortData m_subscriberPortDataMultiProducer{
         SubscriberPortSingleProducer_test::TEST_SERVICE_DESCRIPTION,
         "myApp",
         iox::cxx::VariantQueueTypes::SoFi_MultiProducerSingleConsumer,
-        iox::popo::SubscriberOptions()};
+        iox::popo::SubscriberOptions(),
+        iox::popo::ChunkQueueMemory{&m_queueMemoryMultiProducer, 0U}};
     iox::popo::SubscriberPortUser m_sutUserSideMultiProducer{&m_subscriberPortDataMultiProducer};
     iox::popo::SubscriberPortMultiProducer m_sutRouDiSideMultiProducer{&m_subscriberPortDataMultiProducer};
 };
@@ -54,6 +54,26 @@ TEST_F(RoudiConfigTomlFileProvider_test, ParseDefaultConfigIsSuccessful)
     EXPECT_FALSE(result.has_error());
 }
 
+TEST_F(RoudiConfigTomlFileProvider_test, ParsePortPoolSectionIsSuccessful)
+{
+    m_cmdLineArgs.configFilePath.append(iox::cxx::TruncateToCapacity, "roudi_config_valid_port_pool.toml");
+
+    iox::config::TomlRouDiConfigFileProvider sut(m_cmdLineArgs);
+
+    auto result = sut.parse();
+
+    ASSERT_FALSE(result.has_error());
+    const auto& portPoolConfig = result.value().m_portPoolConfig;
+    EXPECT_THAT(portPoolConfig.m_maxPublishers, Eq(64U));
+    EXPECT_THAT(portPoolConfig.m_maxSubscribers, Eq(128U));
+    EXPECT_THAT(portPoolConfig.m_maxInterfaces, Eq(2U));
+    EXPECT_THAT(portPoolConfig.m_maxApplications, Eq(32U));
+    EXPECT_THAT(portPoolConfig.m_maxNodes, Eq(64U));
+    EXPECT_THAT(portPoolConfig.m_maxConditionVariables, Eq(64U));
+    EXPECT_THAT(portPoolConfig.m_maxPublisherHistory, Eq(4U));
+    EXPECT_THAT(portPoolConfig.m_maxSubscriberQueueCapacity, Eq(64U));
+}
+
 /// we require INSTANTIATE_TEST_CASE_P since we support gtest 1.8 for our safety targets
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
@@ -76,6 +96,14 @@ INSTANTIATE_TEST_CASE_P(
                                  "roudi_config_error_mempool_without_chunk_size.toml"},
            ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::MEMPOOL_WITHOUT_CHUNK_COUNT,
                                  "roudi_config_error_mempool_without_chunk_count.toml"},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::MAX_PORT_POOL_CAPACITY_EXCEEDED,
+                                 "roudi_config_error_max_port_pool_capacity_exceeded.toml"},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_PORT_POOL_CAPACITY,
+                                 "roudi_config_error_port_pool_capacity_negative.toml"},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_PORT_POOL_CAPACITY,
+                                 "roudi_config_error_port_pool_capacity_non_integer.toml"},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_PORT_POOL_CAPACITY,
+                                 "roudi_config_error_port_pool_capacity_zero.toml"},
            ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::EXCEPTION_IN_PARSER,
                                  "toml_parser_exception.toml"}));
 #pragma GCC diagnostic pop
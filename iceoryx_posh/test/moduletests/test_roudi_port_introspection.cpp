@@ -355,11 +355,19 @@ TEST_F(PortIntrospection_test, addAndRemoveSubscriber)
 
     // test adding of ports
     // remark: duplicate subscriber insertions are not possible
-    iox::popo::SubscriberPortData recData1{
-        service1, runtimeName1, iox::cxx::VariantQueueTypes::FiFo_MultiProducerSingleConsumer, subscriberOptions1};
+    iox::popo::SubscriberPortData::ChunkQueue_t::MaxCapacityMemory_t queueMemory1;
+    iox::popo::SubscriberPortData recData1{service1,
+                                           runtimeName1,
+                                           iox::cxx::VariantQueueTypes::FiFo_MultiProducerSingleConsumer,
+                                           subscriberOptions1,
+                                           iox::popo::ChunkQueueMemory{&queueMemory1, 0U}};
     MockSubscriberPortUser port1(&recData1);
-    iox::popo::SubscriberPortData recData2{
-        service2, runtimeName2, iox::cxx::VariantQueueTypes::FiFo_MultiProducerSingleConsumer, subscriberOptions2};
+    iox::popo::SubscriberPortData::ChunkQueue_t::MaxCapacityMemory_t queueMemory2;
+    iox::popo::SubscriberPortData recData2{service2,
+                                           runtimeName2,
+                                           iox::cxx::VariantQueueTypes::FiFo_MultiProducerSingleConsumer,
+                                           subscriberOptions2,
+                                           iox::popo::ChunkQueueMemory{&queueMemory2, 0U}};
     MockSubscriberPortUser port2(&recData2);
     EXPECT_THAT(m_introspectionAccess.addSubscriber(recData1), Eq(true));
     EXPECT_THAT(m_introspectionAccess.addSubscriber(recData1), Eq(false));
@@ -22,6 +22,9 @@
 #include "iceoryx_posh/roudi/port_pool.hpp"
 #include "test.hpp"
 
+#include <memory>
+#include <vector>
+
 namespace
 {
 using namespace ::testing;
@@ -33,8 +36,31 @@ static constexpr uint32_t DEFAULT_MEMORY_TYPE{100U};
 class PortPool_test : public Test
 {
   public:
-    roudi::PortPoolData m_portPoolData;
-    roudi::PortPool sut{m_portPoolData};
+    /// @brief owns the memory and the data of a port pool which is laid out for the given config
+    struct ConfiguredPortPool
+    {
+        explicit ConfiguredPortPool(const config::PortPoolConfig& portPoolConfig)
+            : memory(roudi::PortPoolData::requiredMemorySize(portPoolConfig))
+            , allocator(memory.data(), memory.size())
+            , data(portPoolConfig, allocator)
+            , pool(data)
+        {
+        }
+
+        std::vector<uint8_t> memory;
+        posix::Allocator allocator;
+        roudi::PortPoolData data;
+        roudi::PortPool pool;
+    };
+
+    std::unique_ptr<ConfiguredPortPool> createPool(const config::PortPoolConfig& portPoolConfig)
+    {
+        return std::unique_ptr<ConfiguredPortPool>(new ConfiguredPortPool(portPoolConfig));
+    }
+
+    config::PortPoolConfig m_portPoolConfig;
+    std::unique_ptr<ConfiguredPortPool> m_portPool{createPool(m_portPoolConfig)};
+    roudi::PortPool& sut{m_portPool->pool};
 
     ServiceDescription m_serviceDescription{"service1", "instance1"};
     RuntimeName_t m_applicationName{"AppName"};
@@ -614,4 +640,186 @@ TEST_F(PortPool_test, GetServiceRegistryChangeCounterIsSuccessful)
     ASSERT_EQ(serviceCounter->load(), 1U);
 }
 
+TEST_F(PortPool_test, RequiredMemorySizeScalesWithConfiguredCapacity)
+{
+    config::PortPoolConfig smallPortPoolConfig;
+    smallPortPoolConfig.m_maxPublishers = 1U;
+    smallPortPoolConfig.m_maxSubscribers = 1U;
+
+    EXPECT_LT(roudi::PortPoolData::requiredMemorySize(smallPortPoolConfig),
+              roudi::PortPoolData::requiredMemorySize(m_portPoolConfig));
+}
+
+TEST_F(PortPool_test, AddPublisherPortBeyondConfiguredCapacityReturnsError)
+{
+    constexpr uint32_t CONFIGURED_PUBLISHERS{3U};
+    config::PortPoolConfig portPoolConfig;
+    portPoolConfig.m_maxPublishers = CONFIGURED_PUBLISHERS;
+    auto configuredPool = createPool(portPoolConfig);
+    auto& configuredSut = configuredPool->pool;
+
+    for (uint32_t i = 0U; i < CONFIGURED_PUBLISHERS; ++i)
+    {
+        EXPECT_FALSE(
+            configuredSut
+                .addPublisherPort(
+                    m_serviceDescription, &m_memoryManager, m_applicationName, m_publisherOptions, m_memoryInfo)
+                .has_error());
+    }
+
+    cxx::optional<Error> detectedError;
+    auto errorHandlerGuard = ErrorHandler::SetTemporaryErrorHandler(
+        [&](const Error error, const std::function<void()>, const ErrorLevel) { detectedError.emplace(error); });
+
+    auto publisherPort = configuredSut.addPublisherPort(
+        m_serviceDescription, &m_memoryManager, m_applicationName, m_publisherOptions, m_memoryInfo);
+
+    ASSERT_TRUE(publisherPort.has_error());
+    EXPECT_EQ(publisherPort.get_error(), roudi::PortPoolError::PUBLISHER_PORT_LIST_FULL);
+    ASSERT_TRUE(detectedError.has_value());
+    EXPECT_EQ(detectedError.value(), Error::kPORT_POOL__PUBLISHERLIST_OVERFLOW);
+    EXPECT_EQ(configuredSut.getPublisherPortDataList().size(), CONFIGURED_PUBLISHERS);
+}
+
+TEST_F(PortPool_test, AddSubscriberPortBeyondConfiguredCapacityReturnsError)
+{
+    constexpr uint32_t CONFIGURED_SUBSCRIBERS{2U};
+    config::PortPoolConfig portPoolConfig;
+    portPoolConfig.m_maxSubscribers = CONFIGURED_SUBSCRIBERS;
+    auto configuredPool = createPool(portPoolConfig);
+    auto& configuredSut = configuredPool->pool;
+
+    for (uint32_t i = 0U; i < CONFIGURED_SUBSCRIBERS; ++i)
+    {
+        EXPECT_FALSE(
+            configuredSut.addSubscriberPort(m_serviceDescription, m_applicationName, m_subscriberOptions, m_memoryInfo)
+                .has_error());
+    }
+
+    cxx::optional<Error> detectedError;
+    auto errorHandlerGuard = ErrorHandler::SetTemporaryErrorHandler(
+        [&](const Error error, const std::function<void()>, const ErrorLevel) { detectedError.emplace(error); });
+
+    auto subscriberPort =
+        configuredSut.addSubscriberPort(m_serviceDescription, m_applicationName, m_subscriberOptions, m_memoryInfo);
+
+    ASSERT_TRUE(subscriberPort.has_error());
+    EXPECT_EQ(subscriberPort.get_error(), roudi::PortPoolError::SUBSCRIBER_PORT_LIST_FULL);
+    ASSERT_TRUE(detectedError.has_value());
+    EXPECT_EQ(detectedError.value(), Error::kPORT_POOL__SUBSCRIBERLIST_OVERFLOW);
+}
+
+TEST_F(PortPool_test, AddPublisherPortLimitsHistoryCapacityToConfiguredMaximum)
+{
+    constexpr uint64_t CONFIGURED_HISTORY{2U};
+    config::PortPoolConfig portPoolConfig;
+    portPoolConfig.m_maxPublisherHistory = CONFIGURED_HISTORY;
+    auto configuredPool = createPool(portPoolConfig);
+    auto& configuredSut = configuredPool->pool;
+
+    auto publisherPort = configuredSut.addPublisherPort(
+        m_serviceDescription, &m_memoryManager, m_applicationName, m_publisherOptions, m_memoryInfo);
+
+    ASSERT_FALSE(publisherPort.has_error());
+    EXPECT_EQ(publisherPort.value()->m_chunkSenderData.m_historyCapacity, CONFIGURED_HISTORY);
+}
+
+TEST_F(PortPool_test, AddSubscriberPortLimitsQueueCapacityToConfiguredMaximum)
+{
+    constexpr uint64_t CONFIGURED_QUEUE_CAPACITY{8U};
+    config::PortPoolConfig portPoolConfig;
+    portPoolConfig.m_maxSubscriberQueueCapacity = CONFIGURED_QUEUE_CAPACITY;
+    auto configuredPool = createPool(portPoolConfig);
+    auto& configuredSut = configuredPool->pool;
+
+    auto subscriberPort =
+        configuredSut.addSubscriberPort(m_serviceDescription, m_applicationName, m_subscriberOptions, m_memoryInfo);
+
+    ASSERT_FALSE(subscriberPort.has_error());
+    EXPECT_EQ(subscriberPort.value()->m_chunkReceiverData.m_queue.capacity(), CONFIGURED_QUEUE_CAPACITY);
+}
+
+TEST_F(PortPool_test, AddSubscriberPortWithSmallQueueCapacityUsesSmallQueueStorage)
+{
+    auto subscriberOptions = m_subscriberOptions;
+    subscriberOptions.queueCapacity = 1U;
+
+    auto subscriberPort =
+        sut.addSubscriberPort(m_serviceDescription, m_applicationName, subscriberOptions, m_memoryInfo);
+
+    ASSERT_FALSE(subscriberPort.has_error());
+    EXPECT_EQ(subscriberPort.value()->m_chunkReceiverData.m_queue.capacity(), 1U);
+    EXPECT_EQ(subscriberPort.value()->m_chunkReceiverData.m_queue.maxCapacity(), 1U);
+}
+
+TEST_F(PortPool_test, AddSubscriberPortDoesNotLimitQueueCapacityWithDefaultQueueEntries)
+{
+    constexpr uint32_t CONFIGURED_SUBSCRIBERS{4U};
+    config::PortPoolConfig portPoolConfig;
+    portPoolConfig.m_maxSubscribers = CONFIGURED_SUBSCRIBERS;
+    auto configuredPool = createPool(portPoolConfig);
+    auto& configuredSut = configuredPool->pool;
+    auto subscriberOptions = m_subscriberOptions;
+    subscriberOptions.queueCapacity = MAX_SUBSCRIBER_QUEUE_CAPACITY;
+
+    for (uint32_t i = 0U; i < CONFIGURED_SUBSCRIBERS; ++i)
+    {
+        auto subscriberPort =
+            configuredSut.addSubscriberPort(m_serviceDescription, m_applicationName, subscriberOptions, m_memoryInfo);
+
+        ASSERT_FALSE(subscriberPort.has_error());
+        EXPECT_EQ(subscriberPort.value()->m_chunkReceiverData.m_queue.capacity(), MAX_SUBSCRIBER_QUEUE_CAPACITY);
+    }
+}
+
+TEST_F(PortPool_test, AddSubscriberPortLimitsQueueCapacityWhenConfiguredQueueEntriesAreExhausted)
+{
+    constexpr uint32_t CONFIGURED_SUBSCRIBERS{2U};
+    config::PortPoolConfig portPoolConfig;
+    portPoolConfig.m_maxSubscribers = CONFIGURED_SUBSCRIBERS;
+    portPoolConfig.m_subscriberQueueEntries = 0U;
+    auto configuredPool = createPool(portPoolConfig);
+    auto& configuredSut = configuredPool->pool;
+
+    for (uint32_t i = 0U; i < CONFIGURED_SUBSCRIBERS; ++i)
+    {
+        auto subscriberPort =
+            configuredSut.addSubscriberPort(m_serviceDescription, m_applicationName, m_subscriberOptions, m_memoryInfo);
+
+        ASSERT_FALSE(subscriberPort.has_error());
+        EXPECT_EQ(subscriberPort.value()->m_chunkReceiverData.m_queue.capacity(), 1U);
+    }
+}
+
+TEST_F(PortPool_test, RemoveSubscriberPortReturnsQueueStorageToThePool)
+{
+    config::PortPoolConfig portPoolConfig;
+    portPoolConfig.m_maxSubscribers = 1U;
+    portPoolConfig.m_subscriberQueueEntries = MAX_SUBSCRIBER_QUEUE_CAPACITY;
+    auto configuredPool = createPool(portPoolConfig);
+    auto& configuredSut = configuredPool->pool;
+    auto subscriberOptions = m_subscriberOptions;
+    subscriberOptions.queueCapacity = MAX_SUBSCRIBER_QUEUE_CAPACITY;
+
+    for (uint32_t i = 0U; i < 3U; ++i)
+    {
+        auto subscriberPort =
+            configuredSut.addSubscriberPort(m_serviceDescription, m_applicationName, subscriberOptions, m_memoryInfo);
+
+        ASSERT_FALSE(subscriberPort.has_error());
+        EXPECT_EQ(subscriberPort.value()->m_chunkReceiverData.m_queue.capacity(), MAX_SUBSCRIBER_QUEUE_CAPACITY);
+        configuredSut.removeSubscriberPort(subscriberPort.value());
+    }
+}
+
+TEST_F(PortPool_test, RequiredMemorySizeScalesWithConfiguredSubscriberQueueEntries)
+{
+    config::PortPoolConfig manyEntriesConfig;
+    config::PortPoolConfig fewEntriesConfig;
+    fewEntriesConfig.m_subscriberQueueEntries = fewEntriesConfig.m_maxSubscribers;
+
+    EXPECT_LT(roudi::PortPoolData::requiredMemorySize(fewEntriesConfig),
+              roudi::PortPoolData::requiredMemorySize(manyEntriesConfig));
+}
+
 } // namespace
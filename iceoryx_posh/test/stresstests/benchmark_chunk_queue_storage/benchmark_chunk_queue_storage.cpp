@@ -0,0 +1,106 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/cxx/convert.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_storage.hpp"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+/// @brief The queue of a subscriber is a ChunkQueueStorage whose memory has the size of its capacity class, every call
+///        is dispatched over the capacity class to the cxx::VariantQueue in this memory. The benchmark
+///        compares a push and pop on a ChunkQueueStorage of every capacity class with a push and pop on a
+///        cxx::VariantQueue with the maximum capacity, which is the queue of a ChunkQueueData without a
+///        ChunkQueueStorage.
+
+constexpr uint64_t DEFAULT_NUMBER_OF_ITERATIONS{10000000U};
+constexpr uint64_t MAX_CAPACITY{iox::MAX_SUBSCRIBER_QUEUE_CAPACITY};
+
+using Chunk_t = iox::mepoo::ShmSafeUnmanagedChunk;
+using VariantQueue_t = iox::cxx::VariantQueue<Chunk_t, MAX_CAPACITY>;
+using ChunkQueueStorage_t = iox::popo::ChunkQueueStorage<MAX_CAPACITY>;
+
+/// @brief the queue is accessed through a volatile pointer, like a queue in shared memory the compiler cannot see its
+///        queue type and capacity class and has to evaluate them with every call
+template <typename Queue>
+void PerformBenchmark(const char* scenario, Queue* const volatile queuePointer, const uint64_t numberOfIterations)
+{
+    Queue& queue = *queuePointer;
+    const Chunk_t chunk;
+    uint64_t numberOfPoppedChunks{0U};
+
+    auto begin = std::chrono::steady_clock::now();
+    for (uint64_t i = 0U; i < numberOfIterations; ++i)
+    {
+        static_cast<void>(queue.push(chunk));
+        if (queue.pop().has_value())
+        {
+            ++numberOfPoppedChunks;
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    if (numberOfPoppedChunks != numberOfIterations)
+    {
+        std::cerr << scenario << ": lost chunks" << std::endl;
+    }
+
+    auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count();
+    std::cout << std::setw(18) << scenario << " " << std::setw(10) << numberOfIterations
+              << " iterations : " << std::fixed << std::setprecision(2)
+              << static_cast<double>(nanoseconds) / static_cast<double>(numberOfIterations) << " ns/push+pop"
+              << std::endl;
+}
+
+void PerformBenchmarks(const char* queueTypeName,
+                       const iox::cxx::VariantQueueTypes queueType,
+                       const uint64_t numberOfIterations)
+{
+    std::cout << queueTypeName << std::endl;
+
+    VariantQueue_t variantQueue(queueType);
+    PerformBenchmark("VariantQueue", &variantQueue, numberOfIterations);
+
+    ChunkQueueStorage_t::MaxCapacityMemory_t memory;
+    for (uint64_t capacityClass = 0U; capacityClass < iox::popo::NUMBER_OF_CHUNK_QUEUE_CAPACITY_CLASSES;
+         ++capacityClass)
+    {
+        ChunkQueueStorage_t storage(queueType, iox::popo::ChunkQueueMemory{&memory, capacityClass});
+        std::string scenario = "storage class " + iox::cxx::convert::toString(capacityClass);
+        PerformBenchmark(scenario.c_str(), &storage, numberOfIterations);
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    uint64_t numberOfIterations{DEFAULT_NUMBER_OF_ITERATIONS};
+    if (argc > 1 && !iox::cxx::convert::fromString(argv[1], numberOfIterations))
+    {
+        std::cerr << "usage: " << argv[0] << " [number of iterations]" << std::endl;
+        return 1;
+    }
+
+    PerformBenchmarks(
+        "FiFo SPSC", iox::cxx::VariantQueueTypes::FiFo_SingleProducerSingleConsumer, numberOfIterations);
+    PerformBenchmarks(
+        "SoFi SPSC", iox::cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer, numberOfIterations);
+    PerformBenchmarks("FiFo MPSC", iox::cxx::VariantQueueTypes::FiFo_MultiProducerSingleConsumer, numberOfIterations);
+    PerformBenchmarks("SoFi MPSC", iox::cxx::VariantQueueTypes::SoFi_MultiProducerSingleConsumer, numberOfIterations);
+
+    return 0;
+}
@@ -0,0 +1,116 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/cxx/convert.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+/// @brief The WaitSet and the Listener wait with a ConditionListener on the ConditionVariableData of the process, every
+///        attached event (subscriber, user trigger, ...) notifies it with a ConditionNotifier. The benchmark measures
+///        these notify and wait paths without a runtime:
+///          - notify without waiter: an event occurs while the WaitSet/Listener is busy
+///          - notify then wait: the WaitSet/Listener finds a pending event and does not block
+///          - wake up round trip: the WaitSet/Listener blocks and is woken up by an event of another thread
+
+constexpr uint64_t DEFAULT_NUMBER_OF_ITERATIONS{1000000U};
+
+template <typename Action>
+void PerformBenchmark(const char* scenario, const uint64_t numberOfIterations, const Action& action)
+{
+    auto begin = std::chrono::steady_clock::now();
+    action();
+    auto end = std::chrono::steady_clock::now();
+
+    auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count();
+    std::cout << std::setw(24) << scenario << " " << std::setw(10) << numberOfIterations
+              << " iterations : " << std::fixed << std::setprecision(2)
+              << static_cast<double>(nanoseconds) / static_cast<double>(numberOfIterations) << " ns/iteration"
+              << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace iox::popo;
+
+    uint64_t numberOfIterations{DEFAULT_NUMBER_OF_ITERATIONS};
+    if (argc > 1 && !iox::cxx::convert::fromString(argv[1], numberOfIterations))
+    {
+        std::cerr << "usage: " << argv[0] << " [number of iterations]" << std::endl;
+        return 1;
+    }
+
+    std::cout << "sizeof(ConditionVariableData) " << sizeof(ConditionVariableData) << " bytes, "
+              << std::thread::hardware_concurrency() << " cores" << std::endl;
+
+    {
+        ConditionVariableData condVarData("benchmark");
+        ConditionNotifier notifier(condVarData, 0U);
+        PerformBenchmark("notify without waiter", numberOfIterations, [&] {
+            for (uint64_t i = 0U; i < numberOfIterations; ++i)
+            {
+                notifier.notify();
+            }
+        });
+    }
+
+    {
+        ConditionVariableData condVarData("benchmark");
+        ConditionNotifier notifier(condVarData, 0U);
+        ConditionListener listener(condVarData);
+        PerformBenchmark("notify then wait", numberOfIterations, [&] {
+            for (uint64_t i = 0U; i < numberOfIterations; ++i)
+            {
+                notifier.notify();
+                static_cast<void>(listener.wait());
+            }
+        });
+    }
+
+    {
+        // two threads wake each other up alternately, every iteration contains two blocking waits
+        ConditionVariableData pingData("ping");
+        ConditionVariableData pongData("pong");
+        ConditionNotifier pingNotifier(pingData, 0U);
+        ConditionNotifier pongNotifier(pongData, 0U);
+        ConditionListener pingListener(pingData);
+        ConditionListener pongListener(pongData);
+
+        PerformBenchmark("wake up round trip", numberOfIterations, [&] {
+            std::thread echo([&] {
+                for (uint64_t i = 0U; i < numberOfIterations; ++i)
+                {
+                    static_cast<void>(pingListener.wait());
+                    pongNotifier.notify();
+                }
+            });
+            for (uint64_t i = 0U; i < numberOfIterations; ++i)
+            {
+                pingNotifier.notify();
+                static_cast<void>(pongListener.wait());
+            }
+            echo.join();
+        });
+    }
+
+    return 0;
+}
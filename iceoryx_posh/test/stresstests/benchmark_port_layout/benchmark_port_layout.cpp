@@ -0,0 +1,212 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/cxx/convert.hpp"
+#include "iceoryx_hoofs/cxx/generic_raii.hpp"
+#include "iceoryx_hoofs/platform/platform_settings.hpp"
+#include "iceoryx_posh/internal/popo/ports/publisher_port_roudi.hpp"
+#include "iceoryx_posh/internal/popo/ports/publisher_port_user.hpp"
+#include "iceoryx_posh/internal/popo/ports/subscriber_port_multi_producer.hpp"
+#include "iceoryx_posh/internal/popo/ports/subscriber_port_single_producer.hpp"
+#include "iceoryx_posh/internal/popo/ports/subscriber_port_user.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+#if defined(__linux__)
+#include <pthread.h>
+#endif
+
+/// @brief A publisher port and a subscriber port in process local memory exchange the given number of samples with
+///        a publisher and a subscriber thread on different cores. In contrast to iceperf there is neither RouDi nor
+///        a runtime involved, the benchmark measures the shared port structures, the mempool and the chunk
+///        management only. Run it with 'perf c2c record' to get the HITM events per sample, see README.md.
+
+constexpr uint64_t DEFAULT_NUMBER_OF_SAMPLES{1000000U};
+constexpr uint32_t NUMBER_OF_CHUNKS{1024U};
+constexpr uint32_t CHUNK_SIZE{128U};
+constexpr uint64_t CHUNK_MANAGEMENT_SIZE{256U};
+constexpr uint64_t MEMORY_SIZE{NUMBER_OF_CHUNKS * (CHUNK_SIZE + CHUNK_MANAGEMENT_SIZE)};
+constexpr uint64_t SPIN_LIMIT{1000U};
+
+alignas(64) static uint8_t g_memory[MEMORY_SIZE];
+
+void pinToCore(std::thread& thread, const uint32_t core)
+{
+#if defined(__linux__)
+    if (std::thread::hardware_concurrency() > core)
+    {
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        CPU_SET(core, &cpuSet);
+        pthread_setaffinity_np(thread.native_handle(), sizeof(cpu_set_t), &cpuSet);
+    }
+#else
+    static_cast<void>(thread);
+    static_cast<void>(core);
+#endif
+}
+
+/// @brief yields after SPIN_LIMIT consecutive failed attempts, otherwise a benchmark on a single core would only
+///        measure the time slices of the scheduler
+void spinThenYield(const bool success, uint64_t& failedAttempts)
+{
+    if (success)
+    {
+        failedAttempts = 0U;
+    }
+    else if (++failedAttempts >= SPIN_LIMIT)
+    {
+        failedAttempts = 0U;
+        std::this_thread::yield();
+    }
+}
+
+template <typename SubscriberPortRouDi_t>
+void PerformBenchmark(const char* scenario, const iox::cxx::VariantQueueTypes queueType, const uint64_t numberOfSamples)
+{
+    using namespace iox::popo;
+
+    const iox::capro::ServiceDescription service{"Benchmark", "Port", "Layout"};
+
+    iox::posix::Allocator memoryAllocator{g_memory, MEMORY_SIZE};
+    iox::mepoo::MePooConfig mempoolConfig;
+    mempoolConfig.addMemPool({CHUNK_SIZE, NUMBER_OF_CHUNKS});
+    iox::mepoo::MemoryManager memoryManager;
+    memoryManager.configureMemoryManager(mempoolConfig, memoryAllocator, memoryAllocator);
+
+    PublisherPortData publisherPortData{service, "publisher", &memoryManager, PublisherOptions()};
+    PublisherPortUser publisherPortUser{&publisherPortData};
+    PublisherPortRouDi publisherPortRouDi{&publisherPortData};
+
+    SubscriberPortData::ChunkQueue_t::MaxCapacityMemory_t queueMemory;
+    SubscriberPortData subscriberPortData{
+        service, "subscriber", queueType, SubscriberOptions(), ChunkQueueMemory{&queueMemory, 0U}};
+    SubscriberPortUser subscriberPortUser{&subscriberPortData};
+    SubscriberPortRouDi_t subscriberPortRouDi{&subscriberPortData};
+
+    // the CaPro handshake which is otherwise done by RouDi
+    publisherPortUser.offer();
+    static_cast<void>(publisherPortRouDi.tryGetCaProMessage());
+    subscriberPortUser.subscribe();
+    subscriberPortRouDi.tryGetCaProMessage().and_then([&](auto& subMessage) {
+        publisherPortRouDi.dispatchCaProMessageAndGetPossibleResponse(subMessage).and_then([&](auto& ackMessage) {
+            static_cast<void>(subscriberPortRouDi.dispatchCaProMessageAndGetPossibleResponse(ackMessage));
+        });
+    });
+    if (subscriberPortUser.getSubscriptionState() != iox::SubscribeState::SUBSCRIBED)
+    {
+        std::cerr << scenario << ": subscription failed" << std::endl;
+        return;
+    }
+
+    std::atomic_bool keepRunning{true};
+    std::atomic_bool start{false};
+    // the publisher does not overtake the subscriber by more than the queue capacity, no sample is lost in the queue
+    std::atomic<uint64_t> numberOfReceivedSamples{0U};
+    const uint64_t queueCapacity = subscriberPortData.m_chunkReceiverData.m_queue.capacity();
+
+    std::thread publisher([&] {
+        while (!start)
+        {
+        }
+        uint64_t numberOfSentSamples{0U};
+        uint64_t failedAttempts{0U};
+        while (keepRunning)
+        {
+            bool hasSent{false};
+            if (numberOfSentSamples - numberOfReceivedSamples.load(std::memory_order_relaxed) < queueCapacity)
+            {
+                auto chunk = publisherPortUser.tryAllocateChunk(sizeof(uint64_t),
+                                                                alignof(uint64_t),
+                                                                iox::CHUNK_NO_USER_HEADER_SIZE,
+                                                                iox::CHUNK_NO_USER_HEADER_ALIGNMENT);
+                if (!chunk.has_error())
+                {
+                    publisherPortUser.sendChunk(chunk.value());
+                    ++numberOfSentSamples;
+                    hasSent = true;
+                }
+            }
+            spinThenYield(hasSent, failedAttempts);
+        }
+    });
+    std::thread subscriber([&] {
+        while (!start)
+        {
+        }
+        uint64_t failedAttempts{0U};
+        while (numberOfReceivedSamples.load(std::memory_order_relaxed) < numberOfSamples)
+        {
+            auto chunk = subscriberPortUser.tryGetChunk();
+            if (!chunk.has_error())
+            {
+                subscriberPortUser.releaseChunk(chunk.value());
+                numberOfReceivedSamples.fetch_add(1U, std::memory_order_relaxed);
+            }
+            spinThenYield(!chunk.has_error(), failedAttempts);
+        }
+        keepRunning = false;
+    });
+    pinToCore(publisher, 0U);
+    pinToCore(subscriber, 1U);
+
+    auto begin = std::chrono::steady_clock::now();
+    start = true;
+    subscriber.join();
+    auto end = std::chrono::steady_clock::now();
+    publisher.join();
+
+    auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count();
+    std::cout << std::setw(12) << scenario << " [ publisher " << std::setw(6) << sizeof(PublisherPortData)
+              << " bytes, subscriber " << std::setw(6) << sizeof(SubscriberPortData) << " bytes ] " << std::setw(10)
+              << numberOfSamples << " samples : " << std::fixed << std::setprecision(2)
+              << static_cast<double>(nanoseconds) / static_cast<double>(numberOfSamples) << " ns/sample" << std::endl;
+
+    subscriberPortUser.unsubscribe();
+    static_cast<void>(subscriberPortRouDi.tryGetCaProMessage());
+    publisherPortUser.stopOffer();
+    static_cast<void>(publisherPortRouDi.tryGetCaProMessage());
+    publisherPortRouDi.releaseAllChunks();
+    subscriberPortRouDi.releaseAllChunks();
+}
+
+int main(int argc, char* argv[])
+{
+    uint64_t numberOfSamples{DEFAULT_NUMBER_OF_SAMPLES};
+    if (argc > 1 && !iox::cxx::convert::fromString(argv[1], numberOfSamples))
+    {
+        std::cerr << "usage: " << argv[0] << " [number of samples]" << std::endl;
+        return 1;
+    }
+
+    iox::cxx::GenericRAII uniqueRouDiId{[] { iox::popo::internal::setUniqueRouDiId(0U); },
+                                        [] { iox::popo::internal::unsetUniqueRouDiId(); }};
+
+    std::cout << "cache line size " << iox::platform::IOX_CACHE_LINE_SIZE << " bytes, "
+              << std::thread::hardware_concurrency() << " cores" << std::endl;
+
+    PerformBenchmark<iox::popo::SubscriberPortSingleProducer>(
+        "SoFi SPSC", iox::cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer, numberOfSamples);
+    PerformBenchmark<iox::popo::SubscriberPortMultiProducer>(
+        "SoFi MPSC", iox::cxx::VariantQueueTypes::SoFi_MultiProducerSingleConsumer, numberOfSamples);
+
+    return 0;
+}